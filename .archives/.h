@@ -401,6 +401,10 @@
             gap: 0.5rem;
         }
 
+        .list-sentinel {
+            height: 1px;
+        }
+
         .loading-spinner {
             width: 20px;
             height: 20px;
@@ -559,6 +563,7 @@
                         <span>Loading your tasks...</span>
                     </div>
                 </div>
+                <div class="list-sentinel" id="list-sentinel"></div>
             </section>
         </main>
 
@@ -580,26 +585,46 @@
         const statTotal = document.getElementById('stat-total');
         const statCompleted = document.getElementById('stat-completed');
         const statRemaining = document.getElementById('stat-remaining');
+        const listSentinel = document.getElementById('list-sentinel');
+
+        const PAGE_SIZE = 20;
+        const LIST_FIELDS = 'id,title,description,completed,createdAt,completedAt';
 
         let todos = [];
+        let nextCursor = null;
+        let pageLoading = false;
+
+        // Fetch the next page whenever the sentinel below the list scrolls into view
+        const pageObserver = new IntersectionObserver(entries => {
+            if (entries.some(entry => entry.isIntersecting)) loadMoreTodos();
+        }, { rootMargin: '200px' });
 
         // Initialize app
         async function init() {
-            await loadTodos();
+            await Promise.all([loadTodos(), updateStats()]);
+        }
+
+        async function fetchTodoPage(cursor) {
+            const params = new URLSearchParams({ limit: PAGE_SIZE, fields: LIST_FIELDS });
+            if (cursor) params.set('cursor', cursor);
+
+            const response = await fetch(`${API_BASE}/api/todos?${params}`);
+            if (!response.ok) throw new Error('Failed to load todos');
+            return response.json();
         }
 
-        // Load all todos from API
+        // Load the first page of todos from API
         async function loadTodos() {
             try {
                 clearError();
+                pageObserver.unobserve(listSentinel);
                 todoList.innerHTML = '<div class="loading"><div class="loading-spinner"></div><span>Loading your tasks...</span></div>';
 
-                const response = await fetch(`${API_BASE}/api/todos`);
-                if (!response.ok) throw new Error('Failed to load todos');
-
-                todos = await response.json();
+                const page = await fetchTodoPage(null);
+                todos = page.items;
+                nextCursor = page.nextCursor;
                 renderTodos();
-                updateStats();
+                if (nextCursor) pageObserver.observe(listSentinel);
             } catch (error) {
                 showError('Failed to load todos. Please try again.');
                 console.error('Error loading todos:', error);
@@ -607,6 +632,25 @@
             }
         }
 
+        // Append the next page when scrolling reaches the end of the list
+        async function loadMoreTodos() {
+            if (pageLoading || !nextCursor) return;
+
+            try {
+                pageLoading = true;
+                const page = await fetchTodoPage(nextCursor);
+                todos = todos.concat(page.items);
+                nextCursor = page.nextCursor;
+                renderTodos();
+                if (!nextCursor) pageObserver.unobserve(listSentinel);
+            } catch (error) {
+                showError('Failed to load more tasks.');
+                console.error('Error loading more todos:', error);
+            } finally {
+                pageLoading = false;
+            }
+        }
+
         // Render todos to the DOM
         function renderTodos() {
             if (todos.length === 0) {
@@ -728,15 +772,19 @@
             }
         }
 
-        // Update statistics
-        function updateStats() {
-            const total = todos.length;
-            const completed = todos.filter(t => t.completed).length;
-            const remaining = total - completed;
+        // Update statistics from the whole table; todos only holds the pages loaded so far
+        async function updateStats() {
+            try {
+                const response = await fetch(`${API_BASE}/api/todos/stats`);
+                if (!response.ok) throw new Error('Failed to load stats');
+                const stats = await response.json();
 
-            statTotal.textContent = total;
-            statCompleted.textContent = completed;
-            statRemaining.textContent = remaining;
+                statTotal.textContent = stats.total;
+                statCompleted.textContent = stats.completed;
+                statRemaining.textContent = stats.remaining;
+            } catch (error) {
+                console.error('Error loading stats:', error);
+            }
         }
 
         // Show error message
@@ -9,7 +9,7 @@ CREATE TABLE todos (
 
 CREATE INDEX idx_todos_completed ON todos(completed);
 
-CREATE INDEX idx_todos_createdAt ON todos(createdAt);
+CREATE INDEX idx_todos_createdAt_id ON todos(createdAt DESC, id DESC);
 
 INSERT INTO todos (title, description, completed, createdAt, completedAt) VALUES ('Buy groceries', 'Milk, eggs, bread, and vegetables', 1, '2024-01-15 08:30:00', '2024-01-15 14:45:00');
 
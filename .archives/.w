@@ -1,10 +1,34 @@
+// Columns the list endpoint may project via ?fields=
+const TODO_COLUMNS = ['id', 'title', 'description', 'completed', 'createdAt', 'completedAt'];
+
+// Keyset cursor over (createdAt, id), newest first
+const encodeCursor = (todo) => btoa(JSON.stringify([todo.createdAt, todo.id]));
+const decodeCursor = (cursor) => {
+  try {
+    const parsed = JSON.parse(atob(cursor));
+    // [created_at, id]: anything else would fail inside .bind()
+    const valid = Array.isArray(parsed) && parsed.length === 2
+      && (typeof parsed[0] === 'string' || typeof parsed[0] === 'number')
+      && Number.isInteger(parsed[1]);
+    return valid ? parsed : null;
+  } catch {
+    return null;
+  }
+};
+
+async function etagFor(body) {
+  const digest = await crypto.subtle.digest('SHA-1', new TextEncoder().encode(body));
+  return 'W/"' + [...new Uint8Array(digest)].map(b => b.toString(16).padStart(2, '0')).join('') + '"';
+}
+
 export default {
   async fetch(request, env, ctx) {
     // Add CORS headers to all responses
     const corsHeaders = {
       'Access-Control-Allow-Origin': '*',
       'Access-Control-Allow-Methods': 'GET, POST, PUT, DELETE, OPTIONS',
-      'Access-Control-Allow-Headers': 'Content-Type',
+      'Access-Control-Allow-Headers': 'Content-Type, If-None-Match',
+      'Access-Control-Expose-Headers': 'ETag',
     };
 
     // Handle preflight requests
@@ -18,26 +42,57 @@ export default {
     const url = new URL(request.url);
     const pathname = url.pathname;
 
-    // GET /api/todos - Retrieve all todo items
+    // GET /api/todos?limit=&cursor=&fields= - Retrieve one page of todo items
     if (pathname === '/api/todos' && request.method === 'GET') {
       try {
+        const limit = Math.min(Math.max(parseInt(url.searchParams.get('limit')) || 20, 1), 100);
+        const requested = (url.searchParams.get('fields') || '')
+          .split(',')
+          .filter(field => TODO_COLUMNS.includes(field));
+        const columns = requested.length > 0
+          ? [...new Set([...requested, 'id', 'createdAt'])]
+          : TODO_COLUMNS;
+
+        const cursorParam = url.searchParams.get('cursor');
+        const cursor = cursorParam ? decodeCursor(cursorParam) : null;
+        if (cursorParam && !cursor) {
+          return new Response(JSON.stringify({ error: 'Invalid cursor' }), {
+            status: 400,
+            headers: {
+              'Content-Type': 'application/json',
+              ...corsHeaders,
+            },
+          });
+        }
+
+        const where = cursor ? 'WHERE (createdAt, id) < (?, ?)' : '';
         const { results } = await env.DB.prepare(
-          'SELECT id, title, description, completed, createdAt, completedAt FROM todos ORDER BY createdAt DESC'
-        ).all();
-        
-        const todos = results.map(todo => ({
-          id: todo.id,
-          title: todo.title,
-          description: todo.description,
-          completed: todo.completed === 1,
-          createdAt: todo.createdAt,
-          completedAt: todo.completedAt,
-        }));
+          `SELECT ${columns.join(', ')} FROM todos ${where} ORDER BY createdAt DESC, id DESC LIMIT ?`
+        ).bind(...(cursor || []), limit + 1).all();
+
+        const page = results.slice(0, limit);
+        const nextCursor = results.length > limit ? encodeCursor(page[page.length - 1]) : null;
+
+        const items = page.map(todo => ('completed' in todo ? { ...todo, completed: todo.completed === 1 } : todo));
+
+        const body = JSON.stringify({ items, nextCursor });
+        const etag = await etagFor(body);
+
+        if (request.headers.get('If-None-Match') === etag) {
+          return new Response(null, {
+            status: 304,
+            headers: {
+              ETag: etag,
+              ...corsHeaders,
+            },
+          });
+        }
 
-        return new Response(JSON.stringify(todos), {
+        return new Response(body, {
           status: 200,
           headers: {
             'Content-Type': 'application/json',
+            ETag: etag,
             ...corsHeaders,
           },
         });
@@ -53,6 +108,36 @@ export default {
       }
     }
 
+    // GET /api/todos/stats - Counts over the whole table (the list is paginated)
+    if (pathname === '/api/todos/stats' && request.method === 'GET') {
+      try {
+        const stats = await env.DB.prepare(
+          'SELECT COUNT(*) AS total, COALESCE(SUM(completed), 0) AS completed FROM todos'
+        ).first();
+
+        return new Response(JSON.stringify({
+          total: stats.total,
+          completed: stats.completed,
+          remaining: stats.total - stats.completed,
+        }), {
+          status: 200,
+          headers: {
+            'Content-Type': 'application/json',
+            ...corsHeaders,
+          },
+        });
+      } catch (error) {
+        console.error('Error fetching todo stats:', error);
+        return new Response(JSON.stringify({ error: 'Failed to fetch stats' }), {
+          status: 500,
+          headers: {
+            'Content-Type': 'application/json',
+            ...corsHeaders,
+          },
+        });
+      }
+    }
+
     // POST /api/todos - Create a new todo item
     if (pathname === '/api/todos' && request.method === 'POST') {
       try {
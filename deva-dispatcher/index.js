@@ -1,5 +1,64 @@
+// Per-request metrics: one datapoint per dispatched request.
+// Written to the Analytics Engine dataset bound as METRICS, or POSTed to
+// METRICS_DEV_URL (the platform UI's /api/metrics sink) during local development.
+// Layout: index1 = "{namespace}/{script}"
+//         blob1..5 = namespace, script, method, cache status, dispatcher
+//         double1..4 = status, duration ms, bytes in, bytes out
+// The namespace label comes from METRICS_NAMESPACE in wrangler.toml.
+function recordRequest(env, ctx, point) {
+  try {
+    if (!point.namespace) {
+      console.log("[DEVA-DISPATCHER] METRICS_NAMESPACE is not set; request not recorded");
+      return;
+    }
+    if (env.METRICS_DEV_URL) {
+      ctx.waitUntil(
+        fetch(env.METRICS_DEV_URL, {
+          method: "POST",
+          headers: {
+            "Content-Type": "application/json",
+            ...(env.METRICS_INGEST_TOKEN ? { Authorization: `Bearer ${env.METRICS_INGEST_TOKEN}` } : {}),
+          },
+          body: JSON.stringify({ ...point, timestamp: Date.now() }),
+        }).catch((e) => console.log("[DEVA-DISPATCHER] Metrics sink error:", e.message))
+      );
+    } else if (env.METRICS) {
+      env.METRICS.writeDataPoint({
+        indexes: [`${point.namespace}/${point.script}`.slice(0, 96)],
+        blobs: [point.namespace, point.script, point.method, point.cacheStatus, point.dispatcher],
+        doubles: [point.status, point.durationMs, point.bytesIn, point.bytesOut],
+      });
+    }
+  } catch (e) {
+    console.log("[DEVA-DISPATCHER] Failed to record metrics:", e.message);
+  }
+}
+
+// Count response body bytes as they stream out and record once the body is done
+function meterResponse(response, ctx, onDone) {
+  if (!response.body) {
+    onDone(0);
+    return response;
+  }
+  let bytes = 0;
+  const counter = new TransformStream({
+    transform(chunk, controller) {
+      bytes += chunk.byteLength;
+      controller.enqueue(chunk);
+    },
+  });
+  ctx.waitUntil(
+    response.body
+      .pipeTo(counter.writable)
+      .catch(() => {})
+      .finally(() => onDone(bytes))
+  );
+  return new Response(counter.readable, response);
+}
+
 export default {
-  async fetch(request, env) {
+  async fetch(request, env, ctx) {
+    const startedAt = Date.now();
     const url = new URL(request.url);
     const pathParts = url.pathname.split('/').filter(Boolean);
     
@@ -58,10 +117,22 @@ export default {
       // Forward to user's worker
       console.log("[DEVA-DISPATCHER] Forwarding request to worker...");
       const response = await userWorker.fetch(newRequest);
+      const durationMs = Date.now() - startedAt;
       console.log("[DEVA-DISPATCHER] ✅ Got response from worker, status:", response.status);
+      console.log("[DEVA-DISPATCHER] Duration:", durationMs, "ms");
       console.log("========================================\n");
       
-      return response;
+      return meterResponse(response, ctx, (bytesOut) => recordRequest(env, ctx, {
+        namespace: env.METRICS_NAMESPACE,
+        script: scriptName,
+        method: request.method,
+        status: response.status,
+        durationMs,
+        bytesIn: parseInt(request.headers.get("content-length")) || 0,
+        bytesOut,
+        cacheStatus: response.headers.get("cf-cache-status") || "NONE",
+        dispatcher: "deva-dispatcher",
+      }));
     } catch (e) {
       console.log("[DEVA-DISPATCHER] ❌ Error dispatching to worker");
       console.log("[DEVA-DISPATCHER] Error message:", e.message);
@@ -69,8 +140,25 @@ export default {
       console.log("[DEVA-DISPATCHER] Script name attempted:", scriptName);
       console.log("========================================\n");
       
+      // fetch() also rejects when the worker throws or exceeds its limits;
+      // only a missing script is a 404
+      const notFound = e.message?.startsWith("Worker not found");
+      const status = notFound ? 404 : 500;
+
+      recordRequest(env, ctx, {
+        namespace: env.METRICS_NAMESPACE,
+        script: scriptName,
+        method: request.method,
+        status,
+        durationMs: Date.now() - startedAt,
+        bytesIn: parseInt(request.headers.get("content-length")) || 0,
+        bytesOut: 0,
+        cacheStatus: "NONE",
+        dispatcher: "deva-dispatcher",
+      });
+      
       return new Response(JSON.stringify({
-        error: 'Script not found',
+        error: notFound ? 'Script not found' : 'Worker threw an exception',
         script: scriptName,
         message: e.message,
         dispatcher: 'deva-dispatcher',
@@ -80,10 +168,12 @@ export default {
           pathParts: pathParts,
           attemptedScript: scriptName,
           namespaceBinding: !!env.DISPATCHER,
-          hint: "Make sure the script is deployed to the 'deva test' namespace."
+          hint: notFound
+            ? "Make sure the script is deployed to the 'deva test' namespace."
+            : "The worker threw an uncaught exception or exceeded its CPU limit. Check its logs."
         }
       }, null, 2), { 
-        status: 404,
+        status,
         headers: { 'Content-Type': 'application/json' }
       });
     }
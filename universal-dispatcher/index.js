@@ -16,8 +16,62 @@ const NAMESPACE_BINDINGS = {
   // Add more namespaces here as needed
 };
 
+// Per-request metrics: one datapoint per dispatched request.
+// Written to the Analytics Engine dataset bound as METRICS, or POSTed to
+// METRICS_DEV_URL (the platform UI's /api/metrics sink) during local development.
+// Layout: index1 = "{namespace}/{script}"
+//         blob1..5 = namespace, script, method, cache status, dispatcher
+//         double1..4 = status, duration ms, bytes in, bytes out
+function recordRequest(env, ctx, point) {
+  try {
+    if (env.METRICS_DEV_URL) {
+      ctx.waitUntil(
+        fetch(env.METRICS_DEV_URL, {
+          method: "POST",
+          headers: {
+            "Content-Type": "application/json",
+            ...(env.METRICS_INGEST_TOKEN ? { Authorization: `Bearer ${env.METRICS_INGEST_TOKEN}` } : {}),
+          },
+          body: JSON.stringify({ ...point, timestamp: Date.now() }),
+        }).catch((e) => console.log("[UNIVERSAL-DISPATCHER] Metrics sink error:", e.message))
+      );
+    } else if (env.METRICS) {
+      env.METRICS.writeDataPoint({
+        indexes: [`${point.namespace}/${point.script}`.slice(0, 96)],
+        blobs: [point.namespace, point.script, point.method, point.cacheStatus, point.dispatcher],
+        doubles: [point.status, point.durationMs, point.bytesIn, point.bytesOut],
+      });
+    }
+  } catch (e) {
+    console.log("[UNIVERSAL-DISPATCHER] Failed to record metrics:", e.message);
+  }
+}
+
+// Count response body bytes as they stream out and record once the body is done
+function meterResponse(response, ctx, onDone) {
+  if (!response.body) {
+    onDone(0);
+    return response;
+  }
+  let bytes = 0;
+  const counter = new TransformStream({
+    transform(chunk, controller) {
+      bytes += chunk.byteLength;
+      controller.enqueue(chunk);
+    },
+  });
+  ctx.waitUntil(
+    response.body
+      .pipeTo(counter.writable)
+      .catch(() => {})
+      .finally(() => onDone(bytes))
+  );
+  return new Response(counter.readable, response);
+}
+
 export default {
-  async fetch(request, env) {
+  async fetch(request, env, ctx) {
+    const startedAt = Date.now();
     const url = new URL(request.url);
     const pathParts = url.pathname.split('/').filter(Boolean);
     
@@ -103,19 +157,47 @@ export default {
       });
       
       const response = await userWorker.fetch(newRequest);
-      console.log("[UNIVERSAL-DISPATCHER] Response status:", response.status);
+      const durationMs = Date.now() - startedAt;
+      console.log("[UNIVERSAL-DISPATCHER] Response status:", response.status, "in", durationMs, "ms");
       
-      return response;
+      return meterResponse(response, ctx, (bytesOut) => recordRequest(env, ctx, {
+        namespace: namespaceName,
+        script: scriptName,
+        method: request.method,
+        status: response.status,
+        durationMs,
+        bytesIn: parseInt(request.headers.get("content-length")) || 0,
+        bytesOut,
+        cacheStatus: response.headers.get("cf-cache-status") || "NONE",
+        dispatcher: "universal-dispatcher",
+      }));
     } catch (e) {
       console.error("[UNIVERSAL-DISPATCHER] Error:", e.message);
       
+      // fetch() also rejects when the worker throws or exceeds its limits;
+      // only a missing script is a 404
+      const notFound = e.message?.startsWith("Worker not found");
+      const status = notFound ? 404 : 500;
+
+      recordRequest(env, ctx, {
+        namespace: namespaceName,
+        script: scriptName,
+        method: request.method,
+        status,
+        durationMs: Date.now() - startedAt,
+        bytesIn: parseInt(request.headers.get("content-length")) || 0,
+        bytesOut: 0,
+        cacheStatus: "NONE",
+        dispatcher: "universal-dispatcher",
+      });
+      
       return new Response(JSON.stringify({
-        error: "Script not found",
+        error: notFound ? "Script not found" : "Worker threw an exception",
         namespace: namespaceName,
         script: scriptName,
         message: e.message
       }, null, 2), {
-        status: 404,
+        status,
         headers: { "Content-Type": "application/json" }
       });
     }
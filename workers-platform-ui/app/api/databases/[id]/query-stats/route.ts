@@ -0,0 +1,36 @@
+import { NextResponse } from "next/server";
+import { METRICS_WINDOWS, isMetricsWindow } from "../../../../lib/metrics";
+import { getDatabaseQueryStats } from "../../../../lib/queryStats";
+
+// Per-fingerprint timing and rows-read statistics for one database
+// GET /api/databases/[id]/query-stats?window=1h|24h|7d
+export async function GET(
+  request: Request,
+  { params }: { params: Promise<{ id: string }> }
+) {
+  try {
+    const { id } = await params;
+    const { searchParams } = new URL(request.url);
+    const window = searchParams.get("window") || "24h";
+
+    console.log("[API /databases/query-stats GET] Database ID:", id, "Window:", window);
+
+    if (!isMetricsWindow(window)) {
+      return NextResponse.json(
+        { error: `window must be one of ${Object.keys(METRICS_WINDOWS).join(", ")}` },
+        { status: 400 }
+      );
+    }
+
+    const stats = await getDatabaseQueryStats(id, window);
+    console.log("[API /databases/query-stats GET] Fingerprints:", stats.fingerprints.length);
+
+    return NextResponse.json(stats);
+  } catch (error) {
+    console.error("[API /databases/query-stats GET] Exception:", error);
+    return NextResponse.json(
+      { error: "Internal server error" },
+      { status: 500 }
+    );
+  }
+}
@@ -1,4 +1,5 @@
 import { NextResponse } from "next/server";
+import { recordQuerySamples } from "../../../../lib/queryStats";
 
 const CLOUDFLARE_API_TOKEN_D1 = process.env.CLOUDFLARE_API_TOKEN_D1!;
 const CLOUDFLARE_ACCOUNT_ID = process.env.CLOUDFLARE_ACCOUNT_ID!;
@@ -82,6 +83,15 @@ export async function POST(
     }
 
     console.log("[API /databases/query POST] ✅ Query executed successfully");
+
+    // Keep D1's per-statement meta for the slow-query panel; a failure here
+    // must not fail the query itself
+    try {
+      await recordQuerySamples(id, sql, data.result);
+    } catch (error) {
+      console.error("[API /databases/query POST] Failed to record query stats:", error);
+    }
+
     return NextResponse.json(data.result);
   } catch (error) {
     console.error("[API /databases/query POST] Exception:", error);
@@ -1,4 +1,5 @@
 import { NextResponse } from "next/server";
+import { LIST_CACHE_KEYS, invalidateCachedList } from "../../../lib/listQuery";
 
 const CLOUDFLARE_API_TOKEN_D1 = process.env.CLOUDFLARE_API_TOKEN_D1!;
 const CLOUDFLARE_ACCOUNT_ID = process.env.CLOUDFLARE_ACCOUNT_ID!;
@@ -65,6 +66,8 @@ export async function DELETE(
       );
     }
 
+    invalidateCachedList(LIST_CACHE_KEYS.databases);
+
     return NextResponse.json({ success: true });
   } catch (error) {
     console.error("Error deleting database:", error);
@@ -1,36 +1,89 @@
 import { NextResponse } from "next/server";
+import {
+  LIST_CACHE_KEYS,
+  getCachedList,
+  invalidateCachedList,
+  isPagedRequest,
+  parseListParams,
+  queryList,
+  setCachedList,
+} from "../../lib/listQuery";
 
 const CLOUDFLARE_API_TOKEN_D1 = process.env.CLOUDFLARE_API_TOKEN_D1!;
 const CLOUDFLARE_ACCOUNT_ID = process.env.CLOUDFLARE_ACCOUNT_ID!;
 
 const BASE_URL = `https://api.cloudflare.com/client/v4/accounts/${CLOUDFLARE_ACCOUNT_ID}/d1/database`;
 
-// List all D1 databases
-export async function GET() {
+interface Database {
+  uuid: string;
+  name: string;
+  created_at: string;
+  file_size?: number;
+  num_tables?: number;
+}
+
+// List D1 databases: the full list, or a page when ?limit= is given
+// ?q=<name substring>&sort=name|created_at|file_size|num_tables&order=asc|desc&offset=&limit=
+export async function GET(request: Request) {
   try {
-    console.log("[API /databases GET] Fetching all D1 databases");
-    console.log("[API /databases GET] URL:", BASE_URL);
-    
-    const response = await fetch(BASE_URL, {
-      headers: {
-        "Content-Type": "application/json",
-        Authorization: `Bearer ${CLOUDFLARE_API_TOKEN_D1}`,
-      },
-    });
+    const { searchParams } = new URL(request.url);
+    let databases = getCachedList<Database>(LIST_CACHE_KEYS.databases);
 
-    const data = await response.json();
-    console.log("[API /databases GET] Response status:", response.status);
-    console.log("[API /databases GET] Databases count:", data.result?.length);
+    if (!databases) {
+      console.log("[API /databases GET] Fetching all D1 databases");
+      console.log("[API /databases GET] URL:", BASE_URL);
 
-    if (!data.success) {
-      console.error("[API /databases GET] Error:", data.errors);
-      return NextResponse.json(
-        { error: data.errors?.[0]?.message || "Failed to fetch databases" },
-        { status: response.status }
-      );
+      // The D1 list endpoint pages at 1000 per request
+      databases = [];
+      for (let page = 1; ; page++) {
+        const response = await fetch(`${BASE_URL}?page=${page}&per_page=1000`, {
+          headers: {
+            "Content-Type": "application/json",
+            Authorization: `Bearer ${CLOUDFLARE_API_TOKEN_D1}`,
+          },
+        });
+
+        const data = await response.json();
+        console.log("[API /databases GET] Response status:", response.status, "Page:", page);
+
+        if (!data.success) {
+          console.error("[API /databases GET] Error:", data.errors);
+          return NextResponse.json(
+            { error: data.errors?.[0]?.message || "Failed to fetch databases" },
+            { status: response.status }
+          );
+        }
+
+        const batch = (data.result || []) as Database[];
+        databases.push(...batch);
+        const totalCount = data.result_info?.total_count;
+        if (batch.length < 1000 || (totalCount !== undefined && databases.length >= totalCount)) break;
+      }
+
+      console.log("[API /databases GET] Databases count:", databases.length);
+      setCachedList(LIST_CACHE_KEYS.databases, databases);
     }
 
-    return NextResponse.json(data.result);
+    if (!isPagedRequest(searchParams)) {
+      return NextResponse.json(databases);
+    }
+
+    const listParams = parseListParams(
+      searchParams,
+      ["name", "created_at", "file_size", "num_tables"],
+      "name"
+    );
+    return NextResponse.json(
+      queryList(databases, listParams, {
+        searchText: (db) => db.name,
+        sortValue: {
+          name: (db) => db.name.toLowerCase(),
+          created_at: (db) => db.created_at,
+          file_size: (db) => db.file_size ?? 0,
+          num_tables: (db) => db.num_tables ?? 0,
+        },
+      })
+    );
   } catch (error) {
     console.error("[API /databases GET] Exception:", error);
     return NextResponse.json(
@@ -83,6 +136,8 @@ export async function POST(request: Request) {
       );
     }
 
+    invalidateCachedList(LIST_CACHE_KEYS.databases);
+
     console.log("[API /databases POST] ✅ Database created successfully!");
     console.log("[API /databases POST] Database UUID:", data.result?.uuid);
     console.log("========================================\n");
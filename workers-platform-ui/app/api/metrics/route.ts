@@ -0,0 +1,100 @@
+import { NextResponse } from "next/server";
+import {
+  METRICS_WINDOWS,
+  RequestDatapoint,
+  analyticsEngineConfigured,
+  appendLocalDatapoints,
+  getScriptMetrics,
+  isMetricsWindow,
+} from "../../lib/metrics";
+
+const METRICS_INGEST_TOKEN = process.env.METRICS_INGEST_TOKEN;
+
+// Latency/error/throughput aggregates for one script
+// GET /api/metrics?namespace=...&script=...&window=1h|24h|7d
+export async function GET(request: Request) {
+  try {
+    const { searchParams } = new URL(request.url);
+    const namespace = searchParams.get("namespace");
+    const script = searchParams.get("script");
+    const window = searchParams.get("window") || "24h";
+
+    console.log("[API /metrics GET] Namespace:", namespace, "Script:", script, "Window:", window);
+
+    if (!namespace || !script) {
+      return NextResponse.json(
+        { error: "namespace and script are required" },
+        { status: 400 }
+      );
+    }
+
+    if (!isMetricsWindow(window)) {
+      return NextResponse.json(
+        { error: `window must be one of ${Object.keys(METRICS_WINDOWS).join(", ")}` },
+        { status: 400 }
+      );
+    }
+
+    const metrics = await getScriptMetrics(namespace, script, window);
+    console.log("[API /metrics GET] Source:", metrics.source, "Requests:", metrics.summary.requests);
+
+    return NextResponse.json(metrics);
+  } catch (error) {
+    console.error("[API /metrics GET] Exception:", error);
+    return NextResponse.json(
+      { error: "Internal server error" },
+      { status: 500 }
+    );
+  }
+}
+
+// Local development sink for dispatcher datapoints (see dispatcher METRICS_DEV_URL).
+// Only open while the local source is in use; outside `next dev` it also
+// requires METRICS_INGEST_TOKEN.
+export async function POST(request: Request) {
+  try {
+    if (analyticsEngineConfigured()) {
+      return NextResponse.json(
+        { error: "Local metrics sink is disabled while Analytics Engine is configured" },
+        { status: 404 }
+      );
+    }
+
+    const authorized = METRICS_INGEST_TOKEN
+      ? request.headers.get("authorization") === `Bearer ${METRICS_INGEST_TOKEN}`
+      : process.env.NODE_ENV === "development";
+    if (!authorized) {
+      return NextResponse.json({ error: "Unauthorized" }, { status: 401 });
+    }
+
+    const body = await request.json();
+    const points: RequestDatapoint[] = (Array.isArray(body) ? body : [body]).map((p) => ({
+      timestamp: Number(p.timestamp) || Date.now(),
+      namespace: String(p.namespace || ""),
+      script: String(p.script || ""),
+      method: String(p.method || ""),
+      status: Number(p.status) || 0,
+      durationMs: Number(p.durationMs) || 0,
+      bytesIn: Number(p.bytesIn) || 0,
+      bytesOut: Number(p.bytesOut) || 0,
+      cacheStatus: String(p.cacheStatus || "NONE"),
+      dispatcher: String(p.dispatcher || ""),
+    }));
+
+    if (points.some((p) => !p.namespace || !p.script)) {
+      return NextResponse.json(
+        { error: "namespace and script are required on every datapoint" },
+        { status: 400 }
+      );
+    }
+
+    await appendLocalDatapoints(points);
+    return NextResponse.json({ accepted: points.length }, { status: 202 });
+  } catch (error) {
+    console.error("[API /metrics POST] Exception:", error);
+    return NextResponse.json(
+      { error: "Internal server error" },
+      { status: 500 }
+    );
+  }
+}
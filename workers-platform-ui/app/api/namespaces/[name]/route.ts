@@ -1,4 +1,5 @@
 import { NextResponse } from "next/server";
+import { LIST_CACHE_KEYS, invalidateCachedList } from "../../../lib/listQuery";
 
 const CLOUDFLARE_API_TOKEN_READ = process.env.CLOUDFLARE_API_TOKEN_READ!;
 const CLOUDFLARE_API_TOKEN_EDIT = process.env.CLOUDFLARE_API_TOKEN_EDIT!;
@@ -63,6 +64,9 @@ export async function DELETE(
       );
     }
 
+    invalidateCachedList(LIST_CACHE_KEYS.namespaces);
+    invalidateCachedList(LIST_CACHE_KEYS.scripts(name));
+
     return NextResponse.json({ success: true });
   } catch (error) {
     console.error("Error deleting namespace:", error);
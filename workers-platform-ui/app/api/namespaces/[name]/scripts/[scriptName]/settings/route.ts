@@ -3,9 +3,10 @@ import { NextResponse } from "next/server";
 const CLOUDFLARE_API_TOKEN_READ = process.env.CLOUDFLARE_API_TOKEN_READ!;
 const CLOUDFLARE_API_TOKEN_EDIT = process.env.CLOUDFLARE_API_TOKEN_EDIT!;
 const CLOUDFLARE_ACCOUNT_ID = process.env.CLOUDFLARE_ACCOUNT_ID!;
+const CLOUDFLARE_API_BASE_URL = process.env.CLOUDFLARE_API_BASE_URL || "https://api.cloudflare.com/client/v4";
 
 const getBaseUrl = (namespace: string, scriptName: string) =>
-  `https://api.cloudflare.com/client/v4/accounts/${CLOUDFLARE_ACCOUNT_ID}/workers/dispatch/namespaces/${namespace}/scripts/${scriptName}/settings`;
+  `${CLOUDFLARE_API_BASE_URL}/accounts/${CLOUDFLARE_ACCOUNT_ID}/workers/dispatch/namespaces/${namespace}/scripts/${scriptName}/settings`;
 
 export async function GET(
   request: Request,
@@ -1,42 +1,89 @@
 import { NextResponse } from "next/server";
+import {
+  LIST_CACHE_KEYS,
+  getCachedList,
+  invalidateCachedList,
+  isPagedRequest,
+  parseListParams,
+  queryList,
+  setCachedList,
+} from "../../../../lib/listQuery";
+import { buildUploadMetadata, parseUploadOptions } from "../../../../lib/scriptUpload";
 
 const CLOUDFLARE_API_TOKEN_READ = process.env.CLOUDFLARE_API_TOKEN_READ!;
 const CLOUDFLARE_API_TOKEN_EDIT = process.env.CLOUDFLARE_API_TOKEN_EDIT!;
 const CLOUDFLARE_ACCOUNT_ID = process.env.CLOUDFLARE_ACCOUNT_ID!;
+// Overridable so uploads can be exercised against a local stand-in API
+const CLOUDFLARE_API_BASE_URL = process.env.CLOUDFLARE_API_BASE_URL || "https://api.cloudflare.com/client/v4";
 
 const getBaseUrl = (namespace: string) =>
-  `https://api.cloudflare.com/client/v4/accounts/${CLOUDFLARE_ACCOUNT_ID}/workers/dispatch/namespaces/${namespace}/scripts`;
+  `${CLOUDFLARE_API_BASE_URL}/accounts/${CLOUDFLARE_ACCOUNT_ID}/workers/dispatch/namespaces/${namespace}/scripts`;
 
+interface Script {
+  id: string;
+  created_on: string;
+  modified_on: string;
+}
+
+// Full list, or a page when ?limit= is given:
+// ?q=<name substring>&sort=id|created_on|modified_on&order=asc|desc&offset=&limit=
 export async function GET(
   request: Request,
   { params }: { params: Promise<{ name: string }> }
 ) {
   try {
     const { name } = await params;
-    console.log("[API /namespaces/scripts GET] Fetching scripts for namespace:", name);
-    console.log("[API /namespaces/scripts GET] URL:", getBaseUrl(name));
-
-    const response = await fetch(getBaseUrl(name), {
-      headers: {
-        "Content-Type": "application/json",
-        Authorization: `Bearer ${CLOUDFLARE_API_TOKEN_READ}`,
-      },
-    });
-
-    const data = await response.json();
-    console.log("[API /namespaces/scripts GET] Response status:", response.status);
-    console.log("[API /namespaces/scripts GET] Response success:", data.success);
+    const { searchParams } = new URL(request.url);
+    let scripts = getCachedList<Script>(LIST_CACHE_KEYS.scripts(name));
+
+    if (!scripts) {
+      console.log("[API /namespaces/scripts GET] Fetching scripts for namespace:", name);
+      console.log("[API /namespaces/scripts GET] URL:", getBaseUrl(name));
+
+      const response = await fetch(getBaseUrl(name), {
+        headers: {
+          "Content-Type": "application/json",
+          Authorization: `Bearer ${CLOUDFLARE_API_TOKEN_READ}`,
+        },
+      });
+
+      const data = await response.json();
+      console.log("[API /namespaces/scripts GET] Response status:", response.status);
+      console.log("[API /namespaces/scripts GET] Response success:", data.success);
+
+      if (!data.success) {
+        console.error("[API /namespaces/scripts GET] Error:", data.errors);
+        return NextResponse.json(
+          { error: data.errors?.[0]?.message || "Failed to fetch scripts" },
+          { status: response.status }
+        );
+      }
+
+      console.log("[API /namespaces/scripts GET] Scripts count:", data.result?.length);
+      scripts = (data.result || []) as Script[];
+      setCachedList(LIST_CACHE_KEYS.scripts(name), scripts);
+    }
 
-    if (!data.success) {
-      console.error("[API /namespaces/scripts GET] Error:", data.errors);
-      return NextResponse.json(
-        { error: data.errors?.[0]?.message || "Failed to fetch scripts" },
-        { status: response.status }
-      );
+    if (!isPagedRequest(searchParams)) {
+      return NextResponse.json(scripts);
     }
 
-    console.log("[API /namespaces/scripts GET] Scripts count:", data.result?.length);
-    return NextResponse.json(data.result);
+    const listParams = parseListParams(
+      searchParams,
+      ["id", "created_on", "modified_on"],
+      "modified_on",
+      "desc"
+    );
+    return NextResponse.json(
+      queryList(scripts, listParams, {
+        searchText: (script) => script.id,
+        sortValue: {
+          id: (script) => script.id.toLowerCase(),
+          created_on: (script) => script.created_on,
+          modified_on: (script) => script.modified_on,
+        },
+      })
+    );
   } catch (error) {
     console.error("[API /namespaces/scripts GET] Exception:", error);
     return NextResponse.json(
@@ -74,11 +121,13 @@ export async function PUT(
       );
     }
 
-    const metadata = {
-      main_module: mainModule,
-      compatibility_date: new Date().toISOString().split("T")[0],
-      compatibility_flags: ["nodejs_compat"],
-    };
+    const uploadOptions = parseUploadOptions(formData);
+    if (uploadOptions.error !== undefined) {
+      console.error("[API /namespaces/scripts PUT] Invalid upload options:", uploadOptions.error);
+      return NextResponse.json({ error: uploadOptions.error }, { status: 400 });
+    }
+
+    const metadata = buildUploadMetadata(mainModule, uploadOptions.options);
     console.log("[API /namespaces/scripts PUT] Metadata:", JSON.stringify(metadata));
 
     const uploadFormData = new FormData();
@@ -112,6 +161,10 @@ export async function PUT(
       );
     }
 
+    // script_count on the namespace list changes too
+    invalidateCachedList(LIST_CACHE_KEYS.scripts(name));
+    invalidateCachedList(LIST_CACHE_KEYS.namespaces);
+
     console.log("[API /namespaces/scripts PUT] ✅ Worker deployed successfully!");
     console.log("[API /namespaces/scripts PUT] Worker ID:", data.result?.id);
     console.log("========================================\n");
@@ -1,4 +1,13 @@
 import { NextResponse } from "next/server";
+import {
+  LIST_CACHE_KEYS,
+  getCachedList,
+  invalidateCachedList,
+  isPagedRequest,
+  parseListParams,
+  queryList,
+  setCachedList,
+} from "../../lib/listQuery";
 
 const CLOUDFLARE_API_TOKEN_READ = process.env.CLOUDFLARE_API_TOKEN_READ!;
 const CLOUDFLARE_API_TOKEN_EDIT = process.env.CLOUDFLARE_API_TOKEN_EDIT!;
@@ -6,25 +15,57 @@ const CLOUDFLARE_ACCOUNT_ID = process.env.CLOUDFLARE_ACCOUNT_ID!;
 
 const BASE_URL = `https://api.cloudflare.com/client/v4/accounts/${CLOUDFLARE_ACCOUNT_ID}/workers/dispatch/namespaces`;
 
-export async function GET() {
+interface Namespace {
+  namespace_id: string;
+  namespace_name: string;
+  script_count: number;
+  created_on: string;
+  modified_on: string;
+}
+
+// Full list, or a page when ?limit= is given:
+// ?q=<name substring>&sort=name|created_on|script_count&order=asc|desc&offset=&limit=
+export async function GET(request: Request) {
   try {
-    const response = await fetch(BASE_URL, {
-      headers: {
-        "Content-Type": "application/json",
-        Authorization: `Bearer ${CLOUDFLARE_API_TOKEN_READ}`,
-      },
-    });
+    const { searchParams } = new URL(request.url);
+    let namespaces = getCachedList<Namespace>(LIST_CACHE_KEYS.namespaces);
 
-    const data = await response.json();
+    if (!namespaces) {
+      const response = await fetch(BASE_URL, {
+        headers: {
+          "Content-Type": "application/json",
+          Authorization: `Bearer ${CLOUDFLARE_API_TOKEN_READ}`,
+        },
+      });
 
-    if (!data.success) {
-      return NextResponse.json(
-        { error: data.errors?.[0]?.message || "Failed to fetch namespaces" },
-        { status: response.status }
-      );
+      const data = await response.json();
+
+      if (!data.success) {
+        return NextResponse.json(
+          { error: data.errors?.[0]?.message || "Failed to fetch namespaces" },
+          { status: response.status }
+        );
+      }
+
+      namespaces = data.result as Namespace[];
+      setCachedList(LIST_CACHE_KEYS.namespaces, namespaces);
     }
 
-    return NextResponse.json(data.result);
+    if (!isPagedRequest(searchParams)) {
+      return NextResponse.json(namespaces);
+    }
+
+    const listParams = parseListParams(searchParams, ["name", "created_on", "script_count"], "name");
+    return NextResponse.json(
+      queryList(namespaces, listParams, {
+        searchText: (ns) => ns.namespace_name,
+        sortValue: {
+          name: (ns) => ns.namespace_name.toLowerCase(),
+          created_on: (ns) => ns.created_on,
+          script_count: (ns) => ns.script_count,
+        },
+      })
+    );
   } catch (error) {
     console.error("Error fetching namespaces:", error);
     return NextResponse.json(
@@ -64,6 +105,8 @@ export async function POST(request: Request) {
       );
     }
 
+    invalidateCachedList(LIST_CACHE_KEYS.namespaces);
+
     return NextResponse.json(data.result, { status: 201 });
   } catch (error) {
     console.error("Error creating namespace:", error);
@@ -3,14 +3,17 @@
 import { useState, useCallback, useRef, useEffect } from "react";
 import dynamic from "next/dynamic";
 import {
-  SYSTEM_PROMPTS,
-  generateAnalyzerPrompt,
-  generateWorkerPrompt,
-  generateSchemaPrompt,
-  generateUIPrompt,
-  generateReviewPrompt,
-  generateBugFixPrompt,
-} from "../lib/prompts";
+  CPU_MS_MAX,
+  CPU_MS_MIN,
+  PlacementMode,
+  appendUploadOptions,
+  defaultPlacementFor,
+  latestCompatibilityDate,
+} from "../lib/scriptUpload";
+
+// The prompt library is only needed once generation starts; keep it out of
+// the AI Builder chunk
+const loadPrompts = () => import("../lib/prompts");
 
 // Dynamic import Monaco to avoid SSR issues
 const MonacoEditor = dynamic(() => import("@monaco-editor/react"), {
@@ -109,6 +112,10 @@ export default function AIBuilder({ namespaces, onDeployComplete }: AIBuilderPro
   const uiHTMLRef = useRef("");
   
   // Deployment state
+  // "auto" = Smart Placement when the API worker gets a D1 binding
+  const [placementMode, setPlacementMode] = useState<PlacementMode | "auto">("auto");
+  const [cpuMs, setCpuMs] = useState<number | undefined>(undefined);
+  const [compatibilityDate, setCompatibilityDate] = useState("");
   const [deployError, setDeployError] = useState<string | null>(null);
   const [retryCount, setRetryCount] = useState(0);
   const MAX_RETRIES = 2;
@@ -263,6 +270,14 @@ export default function AIBuilder({ namespaces, onDeployComplete }: AIBuilderPro
       setReview(null);
       setRetryCount(0);
 
+      const {
+        SYSTEM_PROMPTS,
+        generateAnalyzerPrompt,
+        generateSchemaPrompt,
+        generateWorkerPrompt,
+        generateUIPrompt,
+      } = await loadPrompts();
+
       // Step 1: Analyze request
       setStep("analyzing");
       const analyzerResult = await streamGenerate(
@@ -467,10 +482,19 @@ export default function AIBuilder({ namespaces, onDeployComplete }: AIBuilderPro
       console.log("  - Worker code length:", deployWorkerCode.length, "chars");
       console.log("  - API URL:", `/api/namespaces/${selectedNamespace}/scripts`);
       
+      const apiBindings = [{ name: "DB", type: "d1", id: databaseId }];
+      const apiPlacement = placementMode === "auto" ? defaultPlacementFor(apiBindings) : placementMode;
+      console.log("  - Placement:", apiPlacement, "CPU limit:", cpuMs ?? "default");
+
       const workerFormData = new FormData();
       workerFormData.append("scriptName", appName);
       workerFormData.append("script", deployWorkerCode);
       workerFormData.append("mainModule", "index.js");
+      appendUploadOptions(workerFormData, {
+        placementMode: apiPlacement,
+        cpuMs,
+        compatibilityDate: compatibilityDate || undefined,
+      });
 
       const workerResponse = await fetch(`/api/namespaces/${selectedNamespace}/scripts`, {
         method: "PUT",
@@ -493,7 +517,7 @@ export default function AIBuilder({ namespaces, onDeployComplete }: AIBuilderPro
       console.log("  - API URL:", `/api/namespaces/${selectedNamespace}/scripts/${appName}/settings`);
       
       const bindingPayload = {
-        bindings: [{ name: "DB", type: "d1", id: databaseId }],
+        bindings: apiBindings,
       };
       console.log("  - Binding payload:", JSON.stringify(bindingPayload, null, 2));
       
@@ -558,6 +582,8 @@ export default {
       uiFormData.append("scriptName", uiScriptName);
       uiFormData.append("script", uiWorkerCode);
       uiFormData.append("mainModule", "index.js");
+      // Static HTML has no backend to be placed near
+      appendUploadOptions(uiFormData, { compatibilityDate: compatibilityDate || undefined });
 
       const uiResponse = await fetch(`/api/namespaces/${selectedNamespace}/scripts`, {
         method: "PUT",
@@ -628,6 +654,7 @@ export default {
 
     try {
       setIsStreaming(true);
+      const { SYSTEM_PROMPTS, generateReviewPrompt, generateBugFixPrompt } = await loadPrompts();
       
       // Step 1: Review the code to identify issues
       const reviewResult = await streamGenerate(
@@ -869,6 +896,47 @@ export default {
             </select>
           </div>
 
+          {/* Deployment Options */}
+          <div className="mb-4 grid grid-cols-3 gap-3">
+            <div>
+              <label className="block text-xs font-medium mb-1.5 text-white/50">Placement</label>
+              <select
+                value={placementMode}
+                onChange={(e) => setPlacementMode(e.target.value as PlacementMode | "auto")}
+                disabled={isStreaming}
+                className="w-full px-3 py-2 bg-white/5 border border-white/10 rounded-lg text-white text-sm focus:outline-none focus:ring-2 focus:ring-cyan-500/50 disabled:opacity-50"
+              >
+                <option value="auto">Auto (smart with DB)</option>
+                <option value="smart">Smart</option>
+                <option value="off">Off</option>
+              </select>
+            </div>
+            <div>
+              <label className="block text-xs font-medium mb-1.5 text-white/50">CPU limit (ms)</label>
+              <input
+                type="number"
+                min={CPU_MS_MIN}
+                max={CPU_MS_MAX}
+                value={cpuMs ?? ""}
+                onChange={(e) => setCpuMs(e.target.value ? Number(e.target.value) : undefined)}
+                disabled={isStreaming}
+                placeholder="Default"
+                className="w-full px-3 py-2 bg-white/5 border border-white/10 rounded-lg text-white text-sm placeholder:text-white/30 focus:outline-none focus:ring-2 focus:ring-cyan-500/50 disabled:opacity-50"
+              />
+            </div>
+            <div>
+              <label className="block text-xs font-medium mb-1.5 text-white/50">Compatibility date</label>
+              <input
+                type="date"
+                max={latestCompatibilityDate()}
+                value={compatibilityDate}
+                onChange={(e) => setCompatibilityDate(e.target.value)}
+                disabled={isStreaming}
+                className="w-full px-3 py-2 bg-white/5 border border-white/10 rounded-lg text-white text-sm focus:outline-none focus:ring-2 focus:ring-cyan-500/50 disabled:opacity-50 [color-scheme:dark]"
+              />
+            </div>
+          </div>
+
           {/* Request Input */}
           <div className="mb-4">
             <label className="block text-sm font-medium mb-2 text-white/70">
@@ -877,6 +945,7 @@ export default {
             <textarea
               value={userRequest}
               onChange={(e) => setUserRequest(e.target.value)}
+              onFocus={() => loadPrompts()}
               disabled={isStreaming}
               placeholder="Example: Build a todo app where users can create, complete, and delete tasks. Include categories and due dates. Make it look modern with a dark theme."
               rows={4}
@@ -0,0 +1,329 @@
+"use client";
+
+import { useState } from "react";
+import dynamic from "next/dynamic";
+
+// Dynamic import Monaco to avoid SSR issues
+const MonacoEditor = dynamic(() => import("@monaco-editor/react"), {
+  ssr: false,
+  loading: () => (
+    <div className="w-full h-[400px] flex items-center justify-center bg-black/50">
+      <div className="w-6 h-6 border-2 border-white/20 border-t-pink-500 rounded-full animate-spin" />
+    </div>
+  ),
+});
+
+interface Namespace {
+  namespace_id: string;
+  namespace_name: string;
+}
+
+interface StaticSitesProps {
+  namespaces: Namespace[];
+  onError: (message: string | null) => void;
+}
+
+export default function StaticSites({ namespaces, onError }: StaticSitesProps) {
+  const [staticSiteName, setStaticSiteName] = useState("");
+  const [staticSiteHtml, setStaticSiteHtml] = useState("");
+  const [staticSiteNamespace, setStaticSiteNamespace] = useState("");
+  const [staticSiteDeploying, setStaticSiteDeploying] = useState(false);
+  const [staticSiteUrl, setStaticSiteUrl] = useState<string | null>(null);
+
+  // Static site deployment handler
+  const handleDeployStaticSite = async (e: React.FormEvent) => {
+    e.preventDefault();
+    if (!staticSiteName.trim() || !staticSiteHtml.trim() || !staticSiteNamespace) {
+      onError("Please fill in all fields");
+      return;
+    }
+
+    try {
+      setStaticSiteDeploying(true);
+      setStaticSiteUrl(null);
+      onError(null);
+
+      // Generate worker code that serves the HTML
+      const workerCode = `
+// Static Site Worker - Generated by Workers Platform UI
+const HTML_CONTENT = ${JSON.stringify(staticSiteHtml)};
+
+export default {
+  async fetch(request, env, ctx) {
+    const url = new URL(request.url);
+    
+    // Handle CORS preflight
+    if (request.method === "OPTIONS") {
+      return new Response(null, {
+        headers: {
+          "Access-Control-Allow-Origin": "*",
+          "Access-Control-Allow-Methods": "GET, HEAD, OPTIONS",
+          "Access-Control-Allow-Headers": "Content-Type",
+        },
+      });
+    }
+    
+    // Serve the HTML for root or index paths
+    if (url.pathname === "/" || url.pathname === "/index.html") {
+      return new Response(HTML_CONTENT, {
+        headers: {
+          "Content-Type": "text/html;charset=UTF-8",
+          "Cache-Control": "public, max-age=3600",
+          "Access-Control-Allow-Origin": "*",
+        },
+      });
+    }
+    
+    // Return 404 for other paths
+    return new Response("Not Found", { status: 404 });
+  },
+};
+`.trim();
+
+      // Deploy the worker
+      const formData = new FormData();
+      formData.append("scriptName", staticSiteName.trim());
+      formData.append("script", workerCode);
+      formData.append("mainModule", "index.js");
+
+      const response = await fetch(`/api/namespaces/${staticSiteNamespace}/scripts`, {
+        method: "PUT",
+        body: formData,
+      });
+
+      if (!response.ok) {
+        const data = await response.json();
+        throw new Error(data.error || "Failed to deploy static site");
+      }
+
+      // Generate the URL
+      const dispatcherUrl = `https://platform-dispatcher.embitious.workers.dev/${staticSiteName.trim()}`;
+      setStaticSiteUrl(dispatcherUrl);
+      
+      // Clear form
+      setStaticSiteName("");
+      setStaticSiteHtml("");
+    } catch (err) {
+      onError(err instanceof Error ? err.message : "Unknown error");
+    } finally {
+      setStaticSiteDeploying(false);
+    }
+  };
+
+  return (
+    <>
+      <div className="mb-8 flex items-start justify-between gap-4">
+        <div>
+          <h2 className="text-2xl font-semibold tracking-tight mb-2">Static Sites</h2>
+          <p className="text-white/50 text-sm">Deploy HTML pages as Workers</p>
+        </div>
+      </div>
+
+      <div className="grid grid-cols-1 lg:grid-cols-2 gap-6">
+        {/* Deploy Form */}
+        <div className="card bg-white/[0.02] border border-white/5 rounded-xl p-6">
+          <div className="flex items-center gap-3 mb-6">
+            <div className="w-10 h-10 rounded-lg bg-gradient-to-br from-pink-500 to-rose-600 flex items-center justify-center">
+              <svg className="w-5 h-5 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M4 16l4.586-4.586a2 2 0 012.828 0L16 16m-2-2l1.586-1.586a2 2 0 012.828 0L20 14m-6-6h.01M6 20h12a2 2 0 002-2V6a2 2 0 00-2-2H6a2 2 0 00-2 2v12a2 2 0 002 2z" />
+              </svg>
+            </div>
+            <div>
+              <h3 className="font-semibold">Deploy Static Site</h3>
+              <p className="text-xs text-white/40">Paste your HTML and deploy instantly</p>
+            </div>
+          </div>
+
+          <form onSubmit={handleDeployStaticSite}>
+            <div className="mb-4">
+              <label className="block text-sm font-medium mb-2 text-white/70">Namespace</label>
+              <select
+                value={staticSiteNamespace}
+                onChange={(e) => setStaticSiteNamespace(e.target.value)}
+                className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white focus:outline-none focus:ring-2 focus:ring-pink-500/50"
+                required
+              >
+                <option value="">Select a namespace...</option>
+                {namespaces.map((ns) => (
+                  <option key={ns.namespace_id} value={ns.namespace_name}>
+                    {ns.namespace_name}
+                  </option>
+                ))}
+              </select>
+            </div>
+
+            <div className="mb-4">
+              <label className="block text-sm font-medium mb-2 text-white/70">Site Name</label>
+              <input
+                type="text"
+                value={staticSiteName}
+                onChange={(e) => setStaticSiteName(e.target.value)}
+                placeholder="my-static-site"
+                className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white placeholder:text-white/30 focus:outline-none focus:ring-2 focus:ring-pink-500/50 font-mono text-sm"
+                required
+              />
+              <p className="text-xs text-white/40 mt-1">
+                URL will be: https://platform-dispatcher.embitious.workers.dev/{staticSiteName || "site-name"}
+              </p>
+            </div>
+
+            <div className="mb-6">
+              <label className="block text-sm font-medium mb-2 text-white/70">HTML Content</label>
+              <div className="border border-white/10 rounded-xl overflow-hidden">
+                <MonacoEditor
+                  height="400px"
+                  defaultLanguage="html"
+                  value={staticSiteHtml}
+                  onChange={(value) => setStaticSiteHtml(value || "")}
+                  theme="vs-dark"
+                  options={{
+                    minimap: { enabled: false },
+                    fontSize: 12,
+                    lineNumbers: "on",
+                    scrollBeyondLastLine: false,
+                    wordWrap: "on",
+                    folding: true,
+                    automaticLayout: true,
+                    padding: { top: 12, bottom: 12 },
+                    tabSize: 2,
+                  }}
+                />
+              </div>
+              <p className="text-xs text-white/40 mt-2">
+                {staticSiteHtml.length.toLocaleString()} characters
+              </p>
+            </div>
+
+            <button
+              type="submit"
+              disabled={staticSiteDeploying || !staticSiteName.trim() || !staticSiteHtml.trim() || !staticSiteNamespace}
+              className="w-full px-4 py-3 text-sm font-medium bg-gradient-to-r from-pink-500 to-rose-500 text-white rounded-xl disabled:opacity-50 transition-all hover:shadow-lg hover:shadow-pink-500/20 flex items-center justify-center gap-2"
+            >
+              {staticSiteDeploying ? (
+                <>
+                  <div className="w-4 h-4 border-2 border-white/30 border-t-white rounded-full animate-spin" />
+                  Deploying...
+                </>
+              ) : (
+                <>
+                  <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                    <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M7 16a4 4 0 01-.88-7.903A5 5 0 1115.9 6L16 6a5 5 0 011 9.9M15 13l-3-3m0 0l-3 3m3-3v12" />
+                  </svg>
+                  Deploy Static Site
+                </>
+              )}
+            </button>
+          </form>
+
+          {/* Success Message */}
+          {staticSiteUrl && (
+            <div className="mt-6 p-4 bg-emerald-500/10 border border-emerald-500/20 rounded-xl">
+              <div className="flex items-center gap-2 mb-2">
+                <svg className="w-5 h-5 text-emerald-400" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                  <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 12l2 2 4-4m6 2a9 9 0 11-18 0 9 9 0 0118 0z" />
+                </svg>
+                <span className="text-emerald-400 font-medium">Deployed Successfully!</span>
+              </div>
+              <p className="text-sm text-white/60 mb-3">Your static site is now live at:</p>
+              <a
+                href={staticSiteUrl}
+                target="_blank"
+                rel="noopener noreferrer"
+                className="block p-3 bg-black/30 rounded-lg font-mono text-sm text-pink-400 hover:text-pink-300 break-all"
+              >
+                {staticSiteUrl}
+              </a>
+              <button
+                onClick={() => window.open(staticSiteUrl, "_blank")}
+                className="mt-3 w-full px-4 py-2 text-sm font-medium bg-white/5 hover:bg-white/10 text-white rounded-lg transition-all flex items-center justify-center gap-2"
+              >
+                <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                  <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M10 6H6a2 2 0 00-2 2v10a2 2 0 002 2h10a2 2 0 002-2v-4M14 4h6m0 0v6m0-6L10 14" />
+                </svg>
+                Open in New Tab
+              </button>
+            </div>
+          )}
+        </div>
+
+        {/* Info Panel */}
+        <div className="space-y-6">
+          <div className="bg-white/[0.02] border border-white/5 rounded-xl p-6">
+            <h3 className="font-semibold mb-4 flex items-center gap-2">
+              <span className="text-lg">📖</span> How it works
+            </h3>
+            <ol className="space-y-3 text-sm text-white/60">
+              <li className="flex gap-3">
+                <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">1</span>
+                <span>Select a namespace to deploy your site into</span>
+              </li>
+              <li className="flex gap-3">
+                <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">2</span>
+                <span>Enter a unique name for your static site</span>
+              </li>
+              <li className="flex gap-3">
+                <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">3</span>
+                <span>Paste your complete HTML content</span>
+              </li>
+              <li className="flex gap-3">
+                <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">4</span>
+                <span>Click deploy and get your live URL instantly!</span>
+              </li>
+            </ol>
+          </div>
+
+          <div className="bg-white/[0.02] border border-white/5 rounded-xl p-6">
+            <h3 className="font-semibold mb-4 flex items-center gap-2">
+              <span className="text-lg">💡</span> Tips
+            </h3>
+            <ul className="space-y-2 text-sm text-white/60">
+              <li className="flex gap-2">
+                <span className="text-pink-400">•</span>
+                Include all CSS/JS inline or via CDN links
+              </li>
+              <li className="flex gap-2">
+                <span className="text-pink-400">•</span>
+                Perfect for landing pages, dashboards, and demos
+              </li>
+              <li className="flex gap-2">
+                <span className="text-pink-400">•</span>
+                HTML is served with proper content-type headers
+              </li>
+              <li className="flex gap-2">
+                <span className="text-pink-400">•</span>
+                Redeploy anytime by using the same site name
+              </li>
+            </ul>
+          </div>
+
+          <div className="bg-gradient-to-br from-pink-500/10 to-rose-500/10 border border-pink-500/20 rounded-xl p-6">
+            <h3 className="font-semibold mb-2 text-pink-400">🚀 RideShare Demo</h3>
+            <p className="text-sm text-white/60 mb-4">
+              Try deploying the ride-sharing UI! Copy the HTML from the rideshare-app/index.html file and paste it here.
+            </p>
+            <button
+              onClick={() => {
+                setStaticSiteName("rideshare-demo");
+                setStaticSiteHtml(`<!DOCTYPE html>
+<html>
+<head>
+  <title>RideShare Demo</title>
+</head>
+<body style="font-family: system-ui; display: flex; align-items: center; justify-content: center; min-height: 100vh; margin: 0; background: #0a0a0a; color: white;">
+  <div style="text-align: center;">
+    <h1>🚗 RideShare Demo</h1>
+    <p>Paste the full rideshare-app/index.html content here!</p>
+  </div>
+</body>
+</html>`);
+              }}
+              className="text-sm text-pink-400 hover:text-pink-300 font-medium"
+            >
+              Load placeholder template →
+            </button>
+          </div>
+        </div>
+      </div>
+    </>
+  );
+}
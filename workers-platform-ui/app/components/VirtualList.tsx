@@ -0,0 +1,76 @@
+"use client";
+
+import { useEffect, useRef, useState } from "react";
+
+interface VirtualListProps<T> {
+  items: T[];
+  rowHeight: number; // px, including the gap below each row
+  maxHeight?: string;
+  overscan?: number;
+  getKey: (item: T) => string;
+  renderItem: (item: T, index: number) => React.ReactNode;
+  onEndReached?: () => void;
+  footer?: React.ReactNode;
+}
+
+// Fixed-row-height windowed list: only the rows in (or near) the viewport are
+// mounted, so lists with thousands of entries scroll and re-render cheaply.
+export default function VirtualList<T>({
+  items,
+  rowHeight,
+  maxHeight = "70vh",
+  overscan = 6,
+  getKey,
+  renderItem,
+  onEndReached,
+  footer,
+}: VirtualListProps<T>) {
+  const containerRef = useRef<HTMLDivElement>(null);
+  const [scrollTop, setScrollTop] = useState(0);
+  const [viewportHeight, setViewportHeight] = useState(0);
+
+  const onEndReachedRef = useRef(onEndReached);
+  useEffect(() => {
+    onEndReachedRef.current = onEndReached;
+  }, [onEndReached]);
+
+  useEffect(() => {
+    const el = containerRef.current;
+    if (!el) return;
+    const observer = new ResizeObserver(() => setViewportHeight(el.clientHeight));
+    observer.observe(el);
+    return () => observer.disconnect();
+  }, []);
+
+  const start = Math.max(0, Math.floor(scrollTop / rowHeight) - overscan);
+  const end = Math.min(items.length, Math.ceil((scrollTop + viewportHeight) / rowHeight) + overscan);
+
+  // Ask for the next page once the rendered window reaches the last loaded rows
+  useEffect(() => {
+    if (viewportHeight > 0 && items.length > 0 && end >= items.length) {
+      onEndReachedRef.current?.();
+    }
+  }, [end, items.length, viewportHeight]);
+
+  return (
+    <div
+      ref={containerRef}
+      onScroll={(e) => setScrollTop(e.currentTarget.scrollTop)}
+      className="overflow-y-auto"
+      style={{ maxHeight }}
+    >
+      <div className="relative" style={{ height: items.length * rowHeight }}>
+        {items.slice(start, end).map((item, i) => (
+          <div
+            key={getKey(item)}
+            className="absolute left-0 right-0"
+            style={{ top: (start + i) * rowHeight, height: rowHeight }}
+          >
+            {renderItem(item, start + i)}
+          </div>
+        ))}
+      </div>
+      {footer}
+    </div>
+  );
+}
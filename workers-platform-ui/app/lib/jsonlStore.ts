@@ -0,0 +1,110 @@
+// Append-only JSONL stores for locally recorded samples.
+//
+// Rows are partitioned by key and rotated per UTC day:
+//   <dir>/<key>/<YYYY-MM-DD>.jsonl
+// so a read only touches the partition and the days its window covers, and
+// retention is a matter of deleting whole day files. Expired days are pruned
+// on the first append of each day.
+
+import { promises as fs } from "fs";
+import path from "path";
+
+const DAY_MS = 86_400_000;
+
+const dayOf = (ms: number) => new Date(ms).toISOString().slice(0, 10);
+
+// Keys are user-controlled (database ids, script names); keep them one
+// directory level deep
+const partitionName = (key: string) => encodeURIComponent(key).replace(/\./g, "%2E");
+
+export interface JsonlStore<T extends { timestamp: number }> {
+  append(key: string, rows: T[]): Promise<void>;
+  read(key: string, sinceMs: number): Promise<T[]>;
+}
+
+export function createJsonlStore<T extends { timestamp: number }>(
+  dir: string,
+  retentionMs: number
+): JsonlStore<T> {
+  let prunedDay: string | null = null;
+
+  // Delete day files that end before the retention cutoff
+  async function prune() {
+    const cutoffDay = dayOf(Date.now() - retentionMs - DAY_MS);
+    let partitions: string[];
+    try {
+      partitions = await fs.readdir(dir);
+    } catch {
+      return;
+    }
+    for (const partition of partitions) {
+      const partitionDir = path.join(dir, partition);
+      let files: string[];
+      try {
+        files = await fs.readdir(partitionDir);
+      } catch {
+        continue;
+      }
+      const expired = files.filter((f) => f.endsWith(".jsonl") && f.slice(0, 10) <= cutoffDay);
+      await Promise.all(expired.map((f) => fs.rm(path.join(partitionDir, f), { force: true })));
+      if (expired.length === files.length) await fs.rmdir(partitionDir).catch(() => {});
+    }
+  }
+
+  async function append(key: string, rows: T[]) {
+    const now = Date.now();
+    const byDay = new Map<string, T[]>();
+    for (const row of rows) {
+      if (row.timestamp < now - retentionMs) continue;
+      const day = dayOf(row.timestamp);
+      const bucket = byDay.get(day);
+      if (bucket) bucket.push(row);
+      else byDay.set(day, [row]);
+    }
+
+    const partitionDir = path.join(dir, partitionName(key));
+    await fs.mkdir(partitionDir, { recursive: true });
+    for (const [day, dayRows] of byDay) {
+      await fs.appendFile(
+        path.join(partitionDir, `${day}.jsonl`),
+        dayRows.map((r) => JSON.stringify(r)).join("\n") + "\n"
+      );
+    }
+
+    const today = dayOf(now);
+    if (prunedDay !== today) {
+      prunedDay = today;
+      await prune().catch((error) => console.error("[jsonlStore] Prune failed:", dir, error));
+    }
+  }
+
+  async function read(key: string, sinceMs: number) {
+    const partitionDir = path.join(dir, partitionName(key));
+    const days: string[] = [];
+    for (let t = Math.max(sinceMs, Date.now() - retentionMs); dayOf(t) <= dayOf(Date.now()); t += DAY_MS) {
+      days.push(dayOf(t));
+    }
+
+    const rows: T[] = [];
+    for (const day of days) {
+      let raw: string;
+      try {
+        raw = await fs.readFile(path.join(partitionDir, `${day}.jsonl`), "utf8");
+      } catch {
+        continue;
+      }
+      for (const line of raw.split("\n")) {
+        if (!line) continue;
+        try {
+          const row = JSON.parse(line) as T;
+          if (row.timestamp >= sinceMs) rows.push(row);
+        } catch {
+          // Skip partially written lines
+        }
+      }
+    }
+    return rows;
+  }
+
+  return { append, read };
+}
@@ -0,0 +1,101 @@
+// Server-side search, sort and pagination for the list routes
+// (namespaces, scripts in a namespace, D1 databases).
+//
+// The Cloudflare list endpoints return whole collections, so each route keeps
+// the upstream result in a short-lived in-process cache and answers
+// ?q=&sort=&order=&offset=&limit= from it. Requests without `limit` get the
+// full array, as before.
+
+export interface ListPage<T> {
+  items: T[];
+  total: number;
+  offset: number;
+  limit: number;
+}
+
+export interface ListParams {
+  q: string;
+  sort: string;
+  order: "asc" | "desc";
+  offset: number;
+  limit: number;
+}
+
+export const MAX_PAGE_SIZE = 1000;
+
+// Cache keys shared by the list routes and the routes that mutate them
+export const LIST_CACHE_KEYS = {
+  namespaces: "namespaces",
+  scripts: (namespace: string) => `scripts:${namespace}`,
+  databases: "databases",
+};
+
+const LIST_CACHE_TTL_MS = 15_000;
+const listCache = new Map<string, { expires: number; items: unknown[] }>();
+
+export function getCachedList<T>(key: string): T[] | null {
+  const entry = listCache.get(key);
+  if (!entry || entry.expires < Date.now()) {
+    listCache.delete(key);
+    return null;
+  }
+  return entry.items as T[];
+}
+
+export function setCachedList<T>(key: string, items: T[]) {
+  listCache.set(key, { expires: Date.now() + LIST_CACHE_TTL_MS, items });
+}
+
+// Call after any mutation that changes a cached collection
+export function invalidateCachedList(key: string) {
+  listCache.delete(key);
+}
+
+export const isPagedRequest = (searchParams: URLSearchParams) => searchParams.has("limit");
+
+export function parseListParams(
+  searchParams: URLSearchParams,
+  sortKeys: readonly string[],
+  defaultSort: string,
+  defaultOrder: "asc" | "desc" = "asc"
+): ListParams {
+  const sort = searchParams.get("sort") || "";
+  const order = searchParams.get("order");
+  return {
+    q: (searchParams.get("q") || "").trim().toLowerCase(),
+    sort: sortKeys.includes(sort) ? sort : defaultSort,
+    order: order === "asc" || order === "desc" ? order : defaultOrder,
+    offset: Math.max(0, parseInt(searchParams.get("offset") || "0") || 0),
+    limit: Math.min(MAX_PAGE_SIZE, Math.max(1, parseInt(searchParams.get("limit") || "100") || 100)),
+  };
+}
+
+export function queryList<T>(
+  items: T[],
+  params: ListParams,
+  options: {
+    searchText: (item: T) => string;
+    sortValue: Record<string, (item: T) => string | number>;
+  }
+): ListPage<T> {
+  const matching = params.q
+    ? items.filter((item) => options.searchText(item).toLowerCase().includes(params.q))
+    : items;
+
+  const value = options.sortValue[params.sort];
+  const direction = params.order === "asc" ? 1 : -1;
+  const sorted = value
+    ? [...matching].sort((a, b) => {
+        const va = value(a);
+        const vb = value(b);
+        return (va < vb ? -1 : va > vb ? 1 : 0) * direction;
+      })
+    : matching;
+
+  return {
+    items: sorted.slice(params.offset, params.offset + params.limit),
+    total: sorted.length,
+    offset: params.offset,
+    limit: params.limit,
+  };
+}
@@ -0,0 +1,230 @@
+// Per-tenant request metrics emitted by the dispatchers.
+//
+// Production: dispatchers write to the Analytics Engine dataset bound as METRICS
+// and this module reads it back through the Analytics Engine SQL API.
+// Development: dispatchers POST datapoints to /api/metrics, which appends them
+// to local JSONL files (one per script and day, kept for the largest window)
+// that are aggregated here in-process.
+
+import path from "path";
+import { createJsonlStore } from "./jsonlStore";
+
+export interface RequestDatapoint {
+  timestamp: number; // ms since epoch
+  namespace: string;
+  script: string;
+  method: string;
+  status: number;
+  durationMs: number;
+  bytesIn: number;
+  bytesOut: number;
+  cacheStatus: string;
+  dispatcher: string;
+}
+
+export interface MetricsBucket {
+  t: number; // bucket start, seconds since epoch
+  requests: number;
+  errors: number;
+  p50: number;
+  p95: number;
+  p99: number;
+}
+
+export interface MetricsSummary {
+  requests: number;
+  errors: number;
+  errorRate: number;
+  p50: number;
+  p95: number;
+  p99: number;
+  bytesIn: number;
+  bytesOut: number;
+}
+
+export interface ScriptMetrics {
+  source: "analytics-engine" | "local";
+  window: MetricsWindow;
+  bucketSeconds: number;
+  summary: MetricsSummary;
+  series: MetricsBucket[];
+}
+
+export type MetricsWindow = "1h" | "24h" | "7d";
+
+export const METRICS_WINDOWS: Record<MetricsWindow, { seconds: number; bucketSeconds: number }> = {
+  "1h": { seconds: 3600, bucketSeconds: 60 },
+  "24h": { seconds: 86400, bucketSeconds: 1800 },
+  "7d": { seconds: 604800, bucketSeconds: 21600 },
+};
+
+// Own keys only: `in` would also accept "constructor", "toString", ...
+export const isMetricsWindow = (value: string): value is MetricsWindow =>
+  Object.hasOwn(METRICS_WINDOWS, value);
+
+const ANALYTICS_DATASET = process.env.METRICS_DATASET || "tenant_requests";
+const localStore = createJsonlStore<RequestDatapoint>(
+  path.resolve(process.env.METRICS_LOCAL_DIR || ".metrics/requests"),
+  METRICS_WINDOWS["7d"].seconds * 1000
+);
+
+// Dispatchers label namespaces by their URL-safe form ("deva test" -> "deva-test")
+export const toMetricsNamespace = (namespace: string): string =>
+  namespace.toLowerCase().replace(/\s+/g, "-");
+
+export const isErrorStatus = (status: number) => status >= 500;
+
+export const analyticsEngineConfigured = () =>
+  process.env.METRICS_SOURCE !== "local" && !!process.env.CLOUDFLARE_API_TOKEN_ANALYTICS;
+
+// ---------------------------------------------------------------------------
+// Local development sink
+// ---------------------------------------------------------------------------
+
+export async function appendLocalDatapoints(points: RequestDatapoint[]) {
+  const byScript = new Map<string, RequestDatapoint[]>();
+  for (const p of points) {
+    const key = `${p.namespace}/${p.script}`;
+    const group = byScript.get(key);
+    if (group) group.push(p);
+    else byScript.set(key, [p]);
+  }
+  for (const [key, group] of byScript) await localStore.append(key, group);
+}
+
+// Nearest-rank percentile over an ascending array
+const percentile = (sorted: number[], q: number) =>
+  sorted.length === 0 ? 0 : sorted[Math.min(sorted.length - 1, Math.ceil(q * sorted.length) - 1)];
+
+export function aggregateDatapoints(points: RequestDatapoint[], bucketSeconds: number) {
+  const durations = points.map((p) => p.durationMs).sort((a, b) => a - b);
+  const errors = points.filter((p) => isErrorStatus(p.status)).length;
+  const summary: MetricsSummary = {
+    requests: points.length,
+    errors,
+    errorRate: points.length > 0 ? errors / points.length : 0,
+    p50: percentile(durations, 0.5),
+    p95: percentile(durations, 0.95),
+    p99: percentile(durations, 0.99),
+    bytesIn: points.reduce((sum, p) => sum + p.bytesIn, 0),
+    bytesOut: points.reduce((sum, p) => sum + p.bytesOut, 0),
+  };
+
+  const buckets = new Map<number, RequestDatapoint[]>();
+  for (const p of points) {
+    const t = Math.floor(p.timestamp / 1000 / bucketSeconds) * bucketSeconds;
+    const bucket = buckets.get(t);
+    if (bucket) bucket.push(p);
+    else buckets.set(t, [p]);
+  }
+  const series: MetricsBucket[] = [...buckets.entries()]
+    .sort(([a], [b]) => a - b)
+    .map(([t, bucket]) => {
+      const sorted = bucket.map((p) => p.durationMs).sort((a, b) => a - b);
+      return {
+        t,
+        requests: bucket.length,
+        errors: bucket.filter((p) => isErrorStatus(p.status)).length,
+        p50: percentile(sorted, 0.5),
+        p95: percentile(sorted, 0.95),
+        p99: percentile(sorted, 0.99),
+      };
+    });
+
+  return { summary, series };
+}
+
+// ---------------------------------------------------------------------------
+// Analytics Engine SQL API
+// ---------------------------------------------------------------------------
+
+const sqlString = (value: string) => `'${value.replace(/\\/g, "\\\\").replace(/'/g, "\\'")}'`;
+
+async function queryAnalyticsEngine(sql: string) {
+  const response = await fetch(
+    `https://api.cloudflare.com/client/v4/accounts/${process.env.CLOUDFLARE_ACCOUNT_ID}/analytics_engine/sql`,
+    {
+      method: "POST",
+      headers: { Authorization: `Bearer ${process.env.CLOUDFLARE_API_TOKEN_ANALYTICS}` },
+      body: sql,
+    }
+  );
+  if (!response.ok) {
+    throw new Error(`Analytics Engine query failed: ${response.status} ${await response.text()}`);
+  }
+  const data = await response.json();
+  return (data.data || []) as Record<string, string | number>[];
+}
+
+async function fetchAnalyticsEngineMetrics(namespace: string, script: string, window: MetricsWindow) {
+  const { seconds, bucketSeconds } = METRICS_WINDOWS[window];
+  // Sampled rows carry _sample_interval; weight every aggregate by it
+  const aggregates = `
+    SUM(_sample_interval) AS requests,
+    SUM(IF(double1 >= 500, _sample_interval, 0)) AS errors,
+    quantileExactWeighted(0.50)(double2, _sample_interval) AS p50,
+    quantileExactWeighted(0.95)(double2, _sample_interval) AS p95,
+    quantileExactWeighted(0.99)(double2, _sample_interval) AS p99`;
+  const where = `
+    WHERE index1 = ${sqlString(`${namespace}/${script}`.slice(0, 96))}
+      AND blob1 = ${sqlString(namespace)}
+      AND blob2 = ${sqlString(script)}
+      AND timestamp > NOW() - INTERVAL '${seconds}' SECOND`;
+
+  const [summaryRows, seriesRows] = await Promise.all([
+    queryAnalyticsEngine(`
+      SELECT ${aggregates},
+        SUM(double3 * _sample_interval) AS bytesIn,
+        SUM(double4 * _sample_interval) AS bytesOut
+      FROM ${ANALYTICS_DATASET} ${where}
+      FORMAT JSON`),
+    queryAnalyticsEngine(`
+      SELECT intDiv(toUInt32(timestamp), ${bucketSeconds}) * ${bucketSeconds} AS t, ${aggregates}
+      FROM ${ANALYTICS_DATASET} ${where}
+      GROUP BY t
+      ORDER BY t
+      FORMAT JSON`),
+  ]);
+
+  const row = summaryRows[0] || {};
+  const requests = Number(row.requests) || 0;
+  const errors = Number(row.errors) || 0;
+  const summary: MetricsSummary = {
+    requests,
+    errors,
+    errorRate: requests > 0 ? errors / requests : 0,
+    p50: Number(row.p50) || 0,
+    p95: Number(row.p95) || 0,
+    p99: Number(row.p99) || 0,
+    bytesIn: Number(row.bytesIn) || 0,
+    bytesOut: Number(row.bytesOut) || 0,
+  };
+  const series: MetricsBucket[] = seriesRows.map((r) => ({
+    t: Number(r.t),
+    requests: Number(r.requests) || 0,
+    errors: Number(r.errors) || 0,
+    p50: Number(r.p50) || 0,
+    p95: Number(r.p95) || 0,
+    p99: Number(r.p99) || 0,
+  }));
+
+  return { summary, series };
+}
+
+export async function getScriptMetrics(
+  namespace: string,
+  script: string,
+  window: MetricsWindow
+): Promise<ScriptMetrics> {
+  const ns = toMetricsNamespace(namespace);
+  const { seconds, bucketSeconds } = METRICS_WINDOWS[window];
+
+  if (analyticsEngineConfigured()) {
+    const { summary, series } = await fetchAnalyticsEngineMetrics(ns, script, window);
+    return { source: "analytics-engine", window, bucketSeconds, summary, series };
+  }
+
+  const points = await localStore.read(`${ns}/${script}`, Date.now() - seconds * 1000);
+  const { summary, series } = aggregateDatapoints(points, bucketSeconds);
+  return { source: "local", window, bucketSeconds, summary, series };
+}
@@ -62,6 +62,11 @@ Rules:
 - Generate realistic, diverse sample data
 - Use INTEGER PRIMARY KEY for auto-increment IDs
 - Include created_at/updated_at timestamps where appropriate
+- Every table that is listed by the API is paginated with a keyset cursor on (created_at, id) newest-first.
+  For each such table add a composite index matching that order, e.g.:
+  CREATE INDEX idx_items_created_at_id ON items(created_at DESC, id DESC);
+  If a list is also filtered by a column (e.g. a foreign key or status), put that column first:
+  CREATE INDEX idx_items_list_id_created_at_id ON items(list_id, created_at DESC, id DESC);
 
 IMPORTANT: Output ONLY SQL statements, no markdown code blocks, no explanations. Each statement should end with a semicolon.`,
 
@@ -93,6 +98,69 @@ await env.DB.prepare("UPDATE users SET name = ? WHERE id = ?").bind(name, id).ru
 await env.DB.prepare("DELETE FROM users WHERE id = ?").bind(id).run();
 \`\`\`
 
+List endpoints (GET on a collection) MUST NOT return the whole table:
+- Accept ?limit= (default 20, max 100) and ?cursor= (opaque, from the previous page's nextCursor)
+- Paginate with a keyset cursor on (created_at, id) newest-first, never with OFFSET
+- Fetch limit + 1 rows to know whether another page exists
+- Validate the decoded cursor ([created_at as string or number, integer id]) and answer 400 for anything else
+- Accept ?fields=a,b,c to project columns; only allow columns from a fixed whitelist and always select the cursor columns
+- Respond with { "items": [...], "nextCursor": "..." | null }
+- Send a weak ETag computed from the response body and answer 304 when If-None-Match matches
+- Add ETag and If-None-Match to the CORS allowed/exposed headers
+- When the UI shows totals or counts for a list, add GET /api/<collection>/stats that computes them with COUNT(*)/SUM() over the whole table
+
+List endpoint example:
+\`\`\`javascript
+const LIST_COLUMNS = ["id", "name", "email", "created_at"];
+
+const encodeCursor = (row) => btoa(JSON.stringify([row.created_at, row.id]));
+const decodeCursor = (cursor) => {
+  try {
+    const parsed = JSON.parse(atob(cursor));
+    // [created_at, id]: anything else would fail inside .bind()
+    const valid = Array.isArray(parsed) && parsed.length === 2
+      && (typeof parsed[0] === "string" || typeof parsed[0] === "number")
+      && Number.isInteger(parsed[1]);
+    return valid ? parsed : null;
+  } catch {
+    return null;
+  }
+};
+
+async function etagFor(body) {
+  const digest = await crypto.subtle.digest("SHA-1", new TextEncoder().encode(body));
+  return 'W/"' + [...new Uint8Array(digest)].map((b) => b.toString(16).padStart(2, "0")).join("") + '"';
+}
+
+// GET /api/users?limit=20&cursor=...&fields=id,name
+const limit = Math.min(Math.max(parseInt(url.searchParams.get("limit")) || 20, 1), 100);
+const requested = (url.searchParams.get("fields") || "").split(",").filter((f) => LIST_COLUMNS.includes(f));
+const columns = requested.length > 0 ? [...new Set([...requested, "id", "created_at"])] : LIST_COLUMNS;
+
+const cursorParam = url.searchParams.get("cursor");
+const cursor = cursorParam ? decodeCursor(cursorParam) : null;
+if (cursorParam && !cursor) {
+  return new Response(JSON.stringify({ error: "Invalid cursor" }), {
+    status: 400,
+    headers: { "Content-Type": "application/json", ...corsHeaders },
+  });
+}
+const where = cursor ? "WHERE (created_at, id) < (?, ?)" : "";
+const { results } = await env.DB.prepare(
+  \`SELECT \${columns.join(", ")} FROM users \${where} ORDER BY created_at DESC, id DESC LIMIT ?\`
+).bind(...(cursor || []), limit + 1).all();
+
+const items = results.slice(0, limit);
+const nextCursor = results.length > limit ? encodeCursor(items[items.length - 1]) : null;
+const body = JSON.stringify({ items, nextCursor });
+const etag = await etagFor(body);
+
+if (request.headers.get("If-None-Match") === etag) {
+  return new Response(null, { status: 304, headers: { ETag: etag, ...corsHeaders } });
+}
+return new Response(body, { headers: { "Content-Type": "application/json", ETag: etag, ...corsHeaders } });
+\`\`\`
+
 IMPORTANT: Output ONLY the JavaScript code, no markdown code blocks, no explanations. Start directly with the code.`,
 
   // Step 3: Generate static site UI (based on worker API)
@@ -132,6 +200,14 @@ JavaScript Guidelines:
 - Event delegation where appropriate
 - Form validation
 
+Lists and pagination:
+- List endpoints return { items, nextCursor }; never expect a bare array
+- Load the first page with ?limit=20 and request only the fields the list renders via ?fields=
+- Implement infinite scroll: an IntersectionObserver on a sentinel element below the list fetches ?cursor=<nextCursor> and appends
+- Stop observing when nextCursor is null; guard against concurrent page loads
+- Prepend newly created items locally instead of reloading every page
+- Never derive totals or counts from the loaded items (they are only the pages fetched so far); read them from the API's /stats endpoint and refresh it after create/update/delete
+
 DO NOT generate a Cloudflare Worker script. DO NOT wrap HTML in a JavaScript string.
 Output ONLY the HTML file, starting with <!DOCTYPE html>.`,
 
@@ -281,7 +357,8 @@ REQUIRED STRUCTURE:
    const API_BASE = '${apiBaseUrl}';
 
 Example API call pattern:
-  fetch(\`\${API_BASE}/api/items\`)
+  fetch(\`\${API_BASE}/api/items?limit=20&fields=id,title,created_at\`)   // -> { items, nextCursor }
+  fetch(\`\${API_BASE}/api/items?limit=20&cursor=\${encodeURIComponent(nextCursor)}\`)
   fetch(\`\${API_BASE}/api/items/\${id}\`, { method: 'DELETE' })
 
 DO NOT generate a Cloudflare Worker. DO NOT wrap HTML in JavaScript strings.
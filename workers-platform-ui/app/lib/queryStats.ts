@@ -0,0 +1,256 @@
+// Per-database query performance history.
+//
+// /api/databases/[id]/query records one sample per executed statement using
+// D1's result meta (duration, rows_read, rows_written). Statements are grouped
+// by fingerprint: the SQL with comments, literals and whitespace normalized
+// away, so `WHERE id = 1` and `WHERE id = 2` land in the same bucket. Samples
+// are appended to local JSONL files, one per database and day and kept for the
+// largest window, and aggregated in-process for the slow-query panel.
+
+import { createHash } from "crypto";
+import path from "path";
+import { createJsonlStore } from "./jsonlStore";
+import { METRICS_WINDOWS, MetricsWindow } from "./metrics";
+
+export interface QuerySample {
+  timestamp: number; // ms since epoch
+  databaseId: string;
+  fingerprint: string;
+  sql: string; // normalized
+  durationMs: number;
+  rowsRead: number;
+  rowsWritten: number;
+  rowsReturned: number;
+}
+
+export interface QueryTrendBucket {
+  t: number; // bucket start, seconds since epoch
+  calls: number;
+  p50: number;
+  p95: number;
+  rowsRead: number; // average per call
+}
+
+export interface QueryFingerprintStats {
+  fingerprint: string;
+  sql: string;
+  calls: number;
+  totalMs: number;
+  p50: number;
+  p95: number;
+  maxMs: number;
+  avgRowsRead: number;
+  avgRowsReturned: number;
+  avgRowsWritten: number;
+  // p95 in the newer half of the window relative to the older half; null when
+  // either half has too few calls to compare
+  p95Change: number | null;
+  lastSeen: number;
+  histogram: number[]; // call counts per DURATION_BUCKETS_MS range
+  trend: QueryTrendBucket[];
+}
+
+export interface DatabaseQueryStats {
+  window: MetricsWindow;
+  bucketSeconds: number;
+  durationBucketsMs: number[];
+  fingerprints: QueryFingerprintStats[];
+}
+
+// Histogram upper bounds (ms); the last bucket is open-ended
+export const DURATION_BUCKETS_MS = [1, 2, 5, 10, 25, 50, 100, 250, 500, 1000];
+
+const store = createJsonlStore<QuerySample>(
+  path.resolve(process.env.QUERY_STATS_DIR || ".metrics/queries"),
+  METRICS_WINDOWS["7d"].seconds * 1000
+);
+const MAX_FINGERPRINTS = 50;
+const MIN_CALLS_FOR_TREND = 5;
+
+// ---------------------------------------------------------------------------
+// Fingerprinting
+// ---------------------------------------------------------------------------
+
+export function normalizeSQL(sql: string): string {
+  return sql
+    .replace(/--[^\n]*/g, " ")
+    .replace(/\/\*[\s\S]*?\*\//g, " ")
+    .replace(/'(?:[^']|'')*'/g, "?")
+    .replace(/\?\d+|[:@$][A-Za-z_]\w*/g, "?")
+    .replace(/\b0x[0-9a-f]+\b/gi, "?")
+    .replace(/(?<![\w$."])-?\d+(?:\.\d+)?(?:e[+-]?\d+)?\b/gi, "?")
+    .replace(/\s+/g, " ")
+    // "id=?" and "id = ?" are the same query
+    .replace(/\s*([=<>!]+|,)\s*/g, (_, op) => (op === "," ? ", " : ` ${op} `))
+    .replace(/\(\s+/g, "(")
+    .replace(/\s+\)/g, ")")
+    .replace(/\(\?(?:, \?)*\)/g, "(?+)")
+    .replace(/\s*;\s*$/, "")
+    .trim()
+    .toLowerCase();
+}
+
+export const fingerprintSQL = (normalized: string) =>
+  createHash("sha1").update(normalized).digest("hex").slice(0, 12);
+
+// Split a multi-statement batch on top-level semicolons (quote-aware)
+export function splitStatements(sql: string): string[] {
+  const statements: string[] = [];
+  let current = "";
+  let quote: string | null = null;
+  for (const ch of sql) {
+    if (quote) {
+      if (ch === quote) quote = null;
+    } else if (ch === "'" || ch === '"' || ch === "`") {
+      quote = ch;
+    } else if (ch === ";") {
+      if (current.trim()) statements.push(current.trim());
+      current = "";
+      continue;
+    }
+    current += ch;
+  }
+  if (current.trim()) statements.push(current.trim());
+  return statements;
+}
+
+// The platform UI's own catalog lookups are not tenant workload
+const isIntrospection = (normalized: string) => /\bsqlite_master\b|^pragma\b/.test(normalized);
+
+// ---------------------------------------------------------------------------
+// Recording
+// ---------------------------------------------------------------------------
+
+interface D1StatementResult {
+  results?: unknown[];
+  meta?: { duration?: number; rows_read?: number; rows_written?: number };
+}
+
+export async function recordQuerySamples(databaseId: string, sql: string, result: D1StatementResult[]) {
+  if (!Array.isArray(result) || result.length === 0) return;
+
+  // D1 returns one entry per statement; pair them when the split agrees,
+  // otherwise attribute the whole batch to a single fingerprint
+  const statements = splitStatements(sql);
+  const pairs: [string, D1StatementResult[]][] =
+    statements.length === result.length
+      ? statements.map((statement, i) => [statement, [result[i]]])
+      : [[sql, result]];
+
+  const timestamp = Date.now();
+  const samples: QuerySample[] = [];
+  for (const [statement, entries] of pairs) {
+    const normalized = normalizeSQL(statement);
+    if (!normalized || isIntrospection(normalized)) continue;
+    samples.push({
+      timestamp,
+      databaseId,
+      fingerprint: fingerprintSQL(normalized),
+      sql: normalized,
+      durationMs: entries.reduce((sum, e) => sum + (e.meta?.duration ?? 0), 0),
+      rowsRead: entries.reduce((sum, e) => sum + (e.meta?.rows_read ?? 0), 0),
+      rowsWritten: entries.reduce((sum, e) => sum + (e.meta?.rows_written ?? 0), 0),
+      rowsReturned: entries.reduce((sum, e) => sum + (e.results?.length ?? 0), 0),
+    });
+  }
+  if (samples.length === 0) return;
+
+  await store.append(databaseId, samples);
+}
+
+// ---------------------------------------------------------------------------
+// Aggregation
+// ---------------------------------------------------------------------------
+
+// Nearest-rank percentile over an ascending array
+const percentile = (sorted: number[], q: number) =>
+  sorted.length === 0 ? 0 : sorted[Math.min(sorted.length - 1, Math.ceil(q * sorted.length) - 1)];
+
+const average = (values: number[]) =>
+  values.length === 0 ? 0 : values.reduce((sum, v) => sum + v, 0) / values.length;
+
+function histogram(durations: number[]) {
+  const counts = new Array(DURATION_BUCKETS_MS.length + 1).fill(0);
+  for (const d of durations) {
+    const i = DURATION_BUCKETS_MS.findIndex((bound) => d < bound);
+    counts[i === -1 ? DURATION_BUCKETS_MS.length : i]++;
+  }
+  return counts;
+}
+
+export function aggregateQuerySamples(samples: QuerySample[], sinceMs: number, bucketSeconds: number) {
+  const groups = new Map<string, QuerySample[]>();
+  for (const s of samples) {
+    const group = groups.get(s.fingerprint);
+    if (group) group.push(s);
+    else groups.set(s.fingerprint, [s]);
+  }
+
+  const midpoint = sinceMs + (Date.now() - sinceMs) / 2;
+  const stats: QueryFingerprintStats[] = [...groups.values()].map((group) => {
+    const durations = group.map((s) => s.durationMs).sort((a, b) => a - b);
+
+    const older = group.filter((s) => s.timestamp < midpoint).map((s) => s.durationMs).sort((a, b) => a - b);
+    const newer = group.filter((s) => s.timestamp >= midpoint).map((s) => s.durationMs).sort((a, b) => a - b);
+    const olderP95 = percentile(older, 0.95);
+    const p95Change =
+      older.length >= MIN_CALLS_FOR_TREND && newer.length >= MIN_CALLS_FOR_TREND && olderP95 > 0
+        ? (percentile(newer, 0.95) - olderP95) / olderP95
+        : null;
+
+    const buckets = new Map<number, QuerySample[]>();
+    for (const s of group) {
+      const t = Math.floor(s.timestamp / 1000 / bucketSeconds) * bucketSeconds;
+      const bucket = buckets.get(t);
+      if (bucket) bucket.push(s);
+      else buckets.set(t, [s]);
+    }
+    const trend: QueryTrendBucket[] = [...buckets.entries()]
+      .sort(([a], [b]) => a - b)
+      .map(([t, bucket]) => {
+        const sorted = bucket.map((s) => s.durationMs).sort((a, b) => a - b);
+        return {
+          t,
+          calls: bucket.length,
+          p50: percentile(sorted, 0.5),
+          p95: percentile(sorted, 0.95),
+          rowsRead: average(bucket.map((s) => s.rowsRead)),
+        };
+      });
+
+    return {
+      fingerprint: group[0].fingerprint,
+      sql: group[0].sql,
+      calls: group.length,
+      totalMs: durations.reduce((sum, d) => sum + d, 0),
+      p50: percentile(durations, 0.5),
+      p95: percentile(durations, 0.95),
+      maxMs: durations[durations.length - 1],
+      avgRowsRead: average(group.map((s) => s.rowsRead)),
+      avgRowsReturned: average(group.map((s) => s.rowsReturned)),
+      avgRowsWritten: average(group.map((s) => s.rowsWritten)),
+      p95Change,
+      lastSeen: Math.max(...group.map((s) => s.timestamp)),
+      histogram: histogram(durations),
+      trend,
+    };
+  });
+
+  // Most total time first: that is where an index pays off the most
+  return stats.sort((a, b) => b.totalMs - a.totalMs).slice(0, MAX_FINGERPRINTS);
+}
+
+export async function getDatabaseQueryStats(
+  databaseId: string,
+  window: MetricsWindow
+): Promise<DatabaseQueryStats> {
+  const { seconds, bucketSeconds } = METRICS_WINDOWS[window];
+  const sinceMs = Date.now() - seconds * 1000;
+  const samples = await store.read(databaseId, sinceMs);
+  return {
+    window,
+    bucketSeconds,
+    durationBucketsMs: DURATION_BUCKETS_MS,
+    fingerprints: aggregateQuerySamples(samples, sinceMs, bucketSeconds),
+  };
+}
@@ -0,0 +1,100 @@
+// Optional deployment settings accepted by the script upload route
+// (PUT /api/namespaces/[name]/scripts) as extra multipart fields:
+//
+//   placementMode     "smart" | "off"     Smart Placement runs the Worker near
+//                                         its backend (e.g. its D1 database)
+//   cpuMs             10..300000          limits.cpu_ms
+//   compatibilityDate YYYY-MM-DD          pinned date, up to latestCompatibilityDate();
+//                                         defaults to today (UTC)
+//
+// Omitted fields are omitted from the upload metadata, so Cloudflare's
+// defaults apply. There is no usage model option: every Worker runs on the
+// Standard model, and limits.cpu_ms is the remaining knob.
+
+export type PlacementMode = "smart" | "off";
+
+export interface ScriptUploadOptions {
+  placementMode?: PlacementMode;
+  cpuMs?: number;
+  compatibilityDate?: string;
+}
+
+export const PLACEMENT_MODES: PlacementMode[] = ["smart", "off"];
+export const CPU_MS_MIN = 10;
+export const CPU_MS_MAX = 300_000;
+
+export const today = () => new Date().toISOString().split("T")[0];
+
+// Latest accepted compatibility date: tomorrow in UTC. A user east of UTC can
+// already be on the next day, and the date picker offers their local "today".
+// The upload dialogs and the route use this same bound.
+export const latestCompatibilityDate = () =>
+  new Date(Date.now() + 86_400_000).toISOString().split("T")[0];
+
+function isValidCompatibilityDate(value: string) {
+  if (!/^\d{4}-\d{2}-\d{2}$/.test(value)) return false;
+  const date = new Date(`${value}T00:00:00Z`);
+  return !isNaN(date.getTime()) && date.toISOString().startsWith(value) && value <= latestCompatibilityDate();
+}
+
+// Workers bound to a D1 database default to Smart Placement, so each query
+// avoids a round trip from wherever the request happened to land
+export const defaultPlacementFor = (bindings: { type: string }[]): PlacementMode =>
+  bindings.some((b) => b.type === "d1") ? "smart" : "off";
+
+// Client side: append the options to an upload FormData
+export function appendUploadOptions(formData: FormData, options: ScriptUploadOptions) {
+  if (options.placementMode) formData.append("placementMode", options.placementMode);
+  if (options.cpuMs !== undefined) formData.append("cpuMs", String(options.cpuMs));
+  if (options.compatibilityDate) formData.append("compatibilityDate", options.compatibilityDate);
+}
+
+// Server side: read and validate the options from an upload FormData
+export function parseUploadOptions(
+  formData: FormData
+): { options: ScriptUploadOptions; error?: undefined } | { options?: undefined; error: string } {
+  const field = (name: string) => {
+    const value = formData.get(name);
+    return typeof value === "string" && value.trim() !== "" ? value.trim() : undefined;
+  };
+  const options: ScriptUploadOptions = {};
+
+  const placementMode = field("placementMode");
+  if (placementMode !== undefined) {
+    if (!PLACEMENT_MODES.includes(placementMode as PlacementMode)) {
+      return { error: `placementMode must be one of ${PLACEMENT_MODES.join(", ")}` };
+    }
+    options.placementMode = placementMode as PlacementMode;
+  }
+
+  const cpuMs = field("cpuMs");
+  if (cpuMs !== undefined) {
+    const value = Number(cpuMs);
+    if (!Number.isInteger(value) || value < CPU_MS_MIN || value > CPU_MS_MAX) {
+      return { error: `cpuMs must be an integer between ${CPU_MS_MIN} and ${CPU_MS_MAX}` };
+    }
+    options.cpuMs = value;
+  }
+
+  const compatibilityDate = field("compatibilityDate");
+  if (compatibilityDate !== undefined) {
+    if (!isValidCompatibilityDate(compatibilityDate)) {
+      return { error: `compatibilityDate must be a valid YYYY-MM-DD date, no later than ${latestCompatibilityDate()}` };
+    }
+    options.compatibilityDate = compatibilityDate;
+  }
+
+  return { options };
+}
+
+// Upload metadata for the Workers script upload API
+export function buildUploadMetadata(mainModule: string, options: ScriptUploadOptions) {
+  return {
+    main_module: mainModule,
+    compatibility_date: options.compatibilityDate || today(),
+    compatibility_flags: ["nodejs_compat"],
+    // An upload replaces the script's settings, so "off" is just no placement
+    ...(options.placementMode === "smart" ? { placement: { mode: "smart" } } : {}),
+    ...(options.cpuMs !== undefined ? { limits: { cpu_ms: options.cpuMs } } : {}),
+  };
+}
@@ -0,0 +1,58 @@
+// Bulk selection over a server-side list that may not be fully loaded.
+//
+// "Select all" is stored as the query itself plus the ids the user unticked
+// afterwards, so selecting 10k matching rows never materializes 10k ids in the
+// client. The ids are resolved (page by page) when a bulk action's confirm
+// dialog opens, and the action then runs on exactly those ids.
+
+import { ListQuery, listQueryString } from "./usePagedList";
+import { MAX_PAGE_SIZE, type ListPage } from "./listQuery";
+
+export type Selection =
+  | { all: false; ids: Set<string> }
+  | { all: true; excluded: Set<string> };
+
+export const emptySelection = (): Selection => ({ all: false, ids: new Set() });
+
+export const selectAllMatching = (): Selection => ({ all: true, excluded: new Set() });
+
+export const isSelected = (selection: Selection, id: string) =>
+  selection.all ? !selection.excluded.has(id) : selection.ids.has(id);
+
+export const selectionCount = (selection: Selection, total: number) =>
+  selection.all ? Math.max(0, total - selection.excluded.size) : selection.ids.size;
+
+export function toggleSelection(selection: Selection, id: string): Selection {
+  const ids = new Set(selection.all ? selection.excluded : selection.ids);
+  if (ids.has(id)) {
+    ids.delete(id);
+  } else {
+    ids.add(id);
+  }
+  return selection.all ? { all: true, excluded: ids } : { all: false, ids };
+}
+
+// Expand a selection into concrete ids, paging through the list route when
+// everything matching `query` is selected
+export async function resolveSelection<T>(
+  selection: Selection,
+  url: string,
+  query: ListQuery,
+  getId: (item: T) => string
+): Promise<string[]> {
+  if (!selection.all) return Array.from(selection.ids);
+
+  const ids: string[] = [];
+  for (let offset = 0; ; offset += MAX_PAGE_SIZE) {
+    const response = await fetch(`${url}?${listQueryString(query, offset, MAX_PAGE_SIZE)}`);
+    const data = await response.json();
+    if (!response.ok) throw new Error(data.error || "Failed to resolve selection");
+    const page = data as ListPage<T>;
+    for (const item of page.items) {
+      const id = getId(item);
+      if (!selection.excluded.has(id)) ids.push(id);
+    }
+    if (page.items.length === 0 || offset + MAX_PAGE_SIZE >= page.total) break;
+  }
+  return ids;
+}
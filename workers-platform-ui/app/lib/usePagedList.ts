@@ -0,0 +1,102 @@
+"use client";
+
+import { useCallback, useEffect, useRef, useState } from "react";
+import type { ListPage } from "./listQuery";
+
+export interface ListQuery {
+  q: string;
+  sort: string;
+  order: "asc" | "desc";
+}
+
+export const LIST_PAGE_SIZE = 100;
+
+export const listQueryString = (query: ListQuery, offset: number, limit: number) =>
+  new URLSearchParams({
+    q: query.q,
+    sort: query.sort,
+    order: query.order,
+    offset: String(offset),
+    limit: String(limit),
+  }).toString();
+
+// Incrementally loads a server-side searched/sorted list (see lib/listQuery.ts).
+// Pass url = null to pause loading while the list is not on screen.
+export function usePagedList<T>(
+  url: string | null,
+  query: ListQuery,
+  onError: (message: string) => void
+) {
+  const [page, setPage] = useState<{ url: string; key: string; items: T[]; total: number } | null>(null);
+  const [loading, setLoading] = useState(false);
+  const [version, setVersion] = useState(0);
+
+  // Responses for a superseded query/url are dropped
+  const requestId = useRef(0);
+  const inFlight = useRef(false);
+  const onErrorRef = useRef(onError);
+  useEffect(() => {
+    onErrorRef.current = onError;
+  }, [onError]);
+
+  const key = url ? `${url}?${listQueryString(query, 0, 0)}` : "";
+
+  const fetchPage = useCallback(
+    async (offset: number) => {
+      if (!url) return;
+      const id = ++requestId.current;
+      inFlight.current = true;
+      setLoading(true);
+      try {
+        const response = await fetch(`${url}?${listQueryString(query, offset, LIST_PAGE_SIZE)}`);
+        const data = await response.json();
+        if (!response.ok) throw new Error(data.error || "Failed to fetch list");
+        if (id !== requestId.current) return;
+        const { items, total } = data as ListPage<T>;
+        setPage((prev) => ({
+          url,
+          key,
+          items: offset > 0 && prev?.key === key ? [...prev.items, ...items] : items,
+          total,
+        }));
+      } catch (err) {
+        if (id === requestId.current) {
+          onErrorRef.current(err instanceof Error ? err.message : "Unknown error");
+        }
+      } finally {
+        if (id === requestId.current) {
+          inFlight.current = false;
+          setLoading(false);
+        }
+      }
+    },
+    [url, query, key]
+  );
+
+  useEffect(() => {
+    fetchPage(0);
+  }, [fetchPage, version]);
+
+  // Rows from another url are never shown; rows from a previous query stay
+  // up until the new one arrives so the list doesn't flash while typing
+  const current = page && page.url === url ? page : null;
+  const items = current?.items ?? [];
+  const total = current?.total ?? 0;
+
+  const loadMore = useCallback(() => {
+    if (inFlight.current || !page || page.key !== key || page.items.length >= page.total) return;
+    fetchPage(page.items.length);
+  }, [page, key, fetchPage]);
+
+  const reload = useCallback(() => setVersion((v) => v + 1), []);
+
+  return {
+    items,
+    total,
+    loaded: current !== null,
+    loading,
+    hasMore: items.length < total,
+    loadMore,
+    reload,
+  };
+}
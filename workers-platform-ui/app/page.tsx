@@ -1,11 +1,33 @@
 "use client";
 
-import { useState, useEffect, useCallback } from "react";
-import Editor from "@monaco-editor/react";
+import { Fragment, useState, useEffect, useCallback, useRef } from "react";
 import dynamic from "next/dynamic";
-
-// Dynamic import AIBuilder to avoid SSR issues with Monaco
-const AIBuilder = dynamic(() => import("./components/AIBuilder"), {
+import VirtualList from "./components/VirtualList";
+import { ListQuery, usePagedList } from "./lib/usePagedList";
+import {
+  Selection,
+  emptySelection,
+  isSelected,
+  resolveSelection,
+  selectAllMatching,
+  selectionCount,
+  toggleSelection,
+} from "./lib/selection";
+import {
+  CPU_MS_MAX,
+  CPU_MS_MIN,
+  PlacementMode,
+  ScriptUploadOptions,
+  appendUploadOptions,
+  latestCompatibilityDate,
+} from "./lib/scriptUpload";
+
+// Heavy views and Monaco are split into their own chunks and only fetched
+// when first shown (see scripts/bundle-budget.mjs for the first-load budget)
+const loadAIBuilder = () => import("./components/AIBuilder");
+const loadStaticSites = () => import("./components/StaticSites");
+
+const AIBuilder = dynamic(loadAIBuilder, {
   ssr: false,
   loading: () => (
     <div className="flex items-center justify-center h-96">
@@ -14,6 +36,24 @@ const AIBuilder = dynamic(() => import("./components/AIBuilder"), {
   ),
 });
 
+const StaticSites = dynamic(loadStaticSites, {
+  ssr: false,
+  loading: () => (
+    <div className="flex items-center justify-center h-96">
+      <div className="w-8 h-8 border-2 border-white/20 border-t-pink-500 rounded-full animate-spin" />
+    </div>
+  ),
+});
+
+const Editor = dynamic(() => import("@monaco-editor/react"), {
+  ssr: false,
+  loading: () => (
+    <div className="w-full h-full min-h-40 flex items-center justify-center bg-black/50">
+      <div className="w-6 h-6 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+    </div>
+  ),
+});
+
 interface Namespace {
   namespace_id: string;
   namespace_name: string;
@@ -64,6 +104,7 @@ interface Settings {
   logpush: boolean;
   bindings: Binding[];
   placement?: { mode?: string };
+  limits?: { cpu_ms?: number };
   tail_consumers?: unknown[];
 }
 
@@ -100,6 +141,74 @@ interface QueryResult {
   };
 }
 
+interface MetricsBucket {
+  t: number;
+  requests: number;
+  errors: number;
+  p50: number;
+  p95: number;
+  p99: number;
+}
+
+interface ScriptMetrics {
+  source: "analytics-engine" | "local";
+  window: MetricsWindow;
+  bucketSeconds: number;
+  summary: {
+    requests: number;
+    errors: number;
+    errorRate: number;
+    p50: number;
+    p95: number;
+    p99: number;
+    bytesIn: number;
+    bytesOut: number;
+  };
+  series: MetricsBucket[];
+}
+
+type MetricsWindow = "1h" | "24h" | "7d";
+
+const METRICS_WINDOW_SECONDS: Record<MetricsWindow, number> = { "1h": 3600, "24h": 86400, "7d": 604800 };
+
+interface QueryTrendBucket {
+  t: number;
+  calls: number;
+  p50: number;
+  p95: number;
+  rowsRead: number;
+}
+
+interface QueryFingerprintStats {
+  fingerprint: string;
+  sql: string;
+  calls: number;
+  totalMs: number;
+  p50: number;
+  p95: number;
+  maxMs: number;
+  avgRowsRead: number;
+  avgRowsReturned: number;
+  avgRowsWritten: number;
+  p95Change: number | null;
+  lastSeen: number;
+  histogram: number[];
+  trend: QueryTrendBucket[];
+}
+
+interface DatabaseQueryStats {
+  window: MetricsWindow;
+  bucketSeconds: number;
+  durationBucketsMs: number[];
+  fingerprints: QueryFingerprintStats[];
+}
+
+// Rows scanned per row returned above which a fingerprint is flagged as a
+// likely missing index
+const SCAN_RATIO_WARNING = 100;
+// p95 growth between the two halves of the window flagged as a regression
+const REGRESSION_WARNING = 0.5;
+
 interface AvailableResource {
   id: string;
   name: string;
@@ -129,32 +238,43 @@ interface NewBinding {
   environment?: string;
 }
 
+// Fixed slot height of a list card (p-5 card + gap) for VirtualList
+const LIST_ROW_HEIGHT = 104;
+// Selected items listed by name in the bulk delete dialog
+const BULK_PREVIEW_LIMIT = 50;
+
 type View = "namespaces" | "scripts" | "script-detail" | "databases" | "database-detail" | "static-sites" | "ai-builder";
 
 export default function Home() {
   // Navigation state
   const [view, setView] = useState<View>("namespaces");
+  const [openedViews, setOpenedViews] = useState<Set<View>>(new Set());
   const [selectedNamespace, setSelectedNamespace] = useState<string | null>(null);
   const [selectedScript, setSelectedScript] = useState<string | null>(null);
   const [selectedDatabase, setSelectedDatabase] = useState<Database | null>(null);
 
   // Data state
   const [namespaces, setNamespaces] = useState<Namespace[]>([]);
-  const [scripts, setScripts] = useState<Script[]>([]);
   const [scriptDetails, setScriptDetails] = useState<ScriptDetails | null>(null);
   const [bindings, setBindings] = useState<Binding[]>([]);
   const [secrets, setSecrets] = useState<Secret[]>([]);
   const [settings, setSettings] = useState<Settings | null>(null);
   const [tags, setTags] = useState<string[]>([]);
   const [content, setContent] = useState<{ name: string; content: string }[]>([]);
+  const [metrics, setMetrics] = useState<ScriptMetrics | null>(null);
+  const [metricsWindow, setMetricsWindow] = useState<MetricsWindow>("24h");
+  const [metricsLoading, setMetricsLoading] = useState(false);
 
   // Database state
-  const [databases, setDatabases] = useState<Database[]>([]);
   const [tables, setTables] = useState<TableInfo[]>([]);
   const [queryResults, setQueryResults] = useState<QueryResult | null>(null);
   const [sqlQuery, setSqlQuery] = useState("");
   const [queryError, setQueryError] = useState<string | null>(null);
   const [queryLoading, setQueryLoading] = useState(false);
+  const [queryStats, setQueryStats] = useState<DatabaseQueryStats | null>(null);
+  const [queryStatsWindow, setQueryStatsWindow] = useState<MetricsWindow>("24h");
+  const [queryStatsLoading, setQueryStatsLoading] = useState(false);
+  const [expandedFingerprint, setExpandedFingerprint] = useState<string | null>(null);
 
   // Schema builder state
   const [newTableName, setNewTableName] = useState("");
@@ -163,10 +283,10 @@ export default function Home() {
   ]);
 
   // UI state
-  const [loading, setLoading] = useState(true);
+  const [loading, setLoading] = useState(false);
   const [error, setError] = useState<string | null>(null);
-  const [activeTab, setActiveTab] = useState<"overview" | "bindings" | "secrets" | "settings" | "tags" | "content">("overview");
-  const [dbActiveTab, setDbActiveTab] = useState<"tables" | "query" | "schema">("tables");
+  const [activeTab, setActiveTab] = useState<"overview" | "metrics" | "bindings" | "secrets" | "settings" | "tags" | "content">("overview");
+  const [dbActiveTab, setDbActiveTab] = useState<"tables" | "query" | "performance" | "schema">("tables");
 
   // Modal states
   const [showCreateNamespace, setShowCreateNamespace] = useState(false);
@@ -189,16 +309,10 @@ export default function Home() {
   });
   const [bindingLoading, setBindingLoading] = useState(false);
 
-  // Static site state
-  const [staticSiteName, setStaticSiteName] = useState("");
-  const [staticSiteHtml, setStaticSiteHtml] = useState("");
-  const [staticSiteNamespace, setStaticSiteNamespace] = useState("");
-  const [staticSiteDeploying, setStaticSiteDeploying] = useState(false);
-  const [staticSiteUrl, setStaticSiteUrl] = useState<string | null>(null);
-
   // Form states
   const [newNamespaceName, setNewNamespaceName] = useState("");
   const [newScriptName, setNewScriptName] = useState("");
+  const [newScriptOptions, setNewScriptOptions] = useState<ScriptUploadOptions>({});
   const [newScriptContent, setNewScriptContent] = useState(`export default {
   async fetch(request, env, ctx) {
     return new Response("Hello World!");
@@ -211,12 +325,25 @@ export default function Home() {
   const [submitting, setSubmitting] = useState(false);
 
   // Selection states for bulk delete
-  const [selectedNamespaces, setSelectedNamespaces] = useState<Set<string>>(new Set());
-  const [selectedScripts, setSelectedScripts] = useState<Set<string>>(new Set());
+  const [selectedNamespaces, setSelectedNamespaces] = useState<Selection>(emptySelection);
+  const [selectedScripts, setSelectedScripts] = useState<Selection>(emptySelection);
   const [showBulkDeleteConfirm, setShowBulkDeleteConfirm] = useState(false);
+  // Ids the confirm dialog shows and the delete acts on; null while resolving
+  const [bulkDeleteIds, setBulkDeleteIds] = useState<string[] | null>(null);
+  const bulkResolveRequest = useRef(0);
   const [bulkDeleteProgress, setBulkDeleteProgress] = useState<{ current: number; total: number } | null>(null);
 
-  // Fetch namespaces
+  // Server-side searched/sorted/paged lists
+  const [namespaceQuery, setNamespaceQuery] = useState<ListQuery>({ q: "", sort: "name", order: "asc" });
+  const [scriptQuery, setScriptQuery] = useState<ListQuery>({ q: "", sort: "modified_on", order: "desc" });
+  const [databaseQuery, setDatabaseQuery] = useState<ListQuery>({ q: "", sort: "name", order: "asc" });
+  const namespacesUrl = "/api/namespaces";
+  const scriptsUrl = selectedNamespace ? `/api/namespaces/${selectedNamespace}/scripts` : null;
+  const namespaceList = usePagedList<Namespace>(view === "namespaces" ? namespacesUrl : null, namespaceQuery, setError);
+  const scriptList = usePagedList<Script>(view === "scripts" ? scriptsUrl : null, scriptQuery, setError);
+  const databaseList = usePagedList<Database>(view === "databases" ? "/api/databases" : null, databaseQuery, setError);
+
+  // Fetch all namespaces (namespace pickers in Static Sites and AI Builder)
   const fetchNamespaces = useCallback(async () => {
     try {
       setLoading(true);
@@ -232,22 +359,6 @@ export default function Home() {
     }
   }, []);
 
-  // Fetch scripts for a namespace
-  const fetchScripts = useCallback(async (namespace: string) => {
-    try {
-      setLoading(true);
-      const response = await fetch(`/api/namespaces/${namespace}/scripts`);
-      if (!response.ok) throw new Error("Failed to fetch scripts");
-      const data = await response.json();
-      setScripts(data);
-      setError(null);
-    } catch (err) {
-      setError(err instanceof Error ? err.message : "Unknown error");
-    } finally {
-      setLoading(false);
-    }
-  }, []);
-
   // Fetch script details
   const fetchScriptDetails = useCallback(async (namespace: string, scriptName: string) => {
     try {
@@ -278,19 +389,19 @@ export default function Home() {
     }
   }, []);
 
-  // Fetch databases
-  const fetchDatabases = useCallback(async () => {
+  // Fetch request metrics for a script
+  const fetchMetrics = useCallback(async (namespace: string, scriptName: string, range: MetricsWindow) => {
     try {
-      setLoading(true);
-      const response = await fetch("/api/databases");
-      if (!response.ok) throw new Error("Failed to fetch databases");
+      setMetricsLoading(true);
+      const params = new URLSearchParams({ namespace, script: scriptName, window: range });
+      const response = await fetch(`/api/metrics?${params}`);
       const data = await response.json();
-      setDatabases(data);
-      setError(null);
+      if (!response.ok) throw new Error(data.error || "Failed to fetch metrics");
+      setMetrics(data);
     } catch (err) {
       setError(err instanceof Error ? err.message : "Unknown error");
     } finally {
-      setLoading(false);
+      setMetricsLoading(false);
     }
   }, []);
 
@@ -318,6 +429,21 @@ export default function Home() {
     }
   }, []);
 
+  // Fetch per-fingerprint query statistics for a database
+  const fetchQueryStats = useCallback(async (databaseId: string, range: MetricsWindow) => {
+    try {
+      setQueryStatsLoading(true);
+      const response = await fetch(`/api/databases/${databaseId}/query-stats?window=${range}`);
+      const data = await response.json();
+      if (!response.ok) throw new Error(data.error || "Failed to fetch query stats");
+      setQueryStats(data);
+    } catch (err) {
+      setError(err instanceof Error ? err.message : "Unknown error");
+    } finally {
+      setQueryStatsLoading(false);
+    }
+  }, []);
+
   // Fetch available resources for bindings
   const fetchAvailableResources = useCallback(async () => {
     try {
@@ -336,17 +462,11 @@ export default function Home() {
 
   // Effects
   useEffect(() => {
-    if (view === "namespaces" || view === "static-sites" || view === "ai-builder") {
+    if (view === "static-sites" || view === "ai-builder") {
       fetchNamespaces();
     }
   }, [view, fetchNamespaces]);
 
-  useEffect(() => {
-    if (view === "scripts" && selectedNamespace) {
-      fetchScripts(selectedNamespace);
-    }
-  }, [view, selectedNamespace, fetchScripts]);
-
   useEffect(() => {
     if (view === "script-detail" && selectedNamespace && selectedScript) {
       fetchScriptDetails(selectedNamespace, selectedScript);
@@ -354,10 +474,10 @@ export default function Home() {
   }, [view, selectedNamespace, selectedScript, fetchScriptDetails]);
 
   useEffect(() => {
-    if (view === "databases") {
-      fetchDatabases();
+    if (view === "script-detail" && activeTab === "metrics" && selectedNamespace && selectedScript) {
+      fetchMetrics(selectedNamespace, selectedScript, metricsWindow);
     }
-  }, [view, fetchDatabases]);
+  }, [view, activeTab, selectedNamespace, selectedScript, metricsWindow, fetchMetrics]);
 
   useEffect(() => {
     if (view === "database-detail" && selectedDatabase) {
@@ -365,15 +485,30 @@ export default function Home() {
     }
   }, [view, selectedDatabase, fetchTables]);
 
+  useEffect(() => {
+    if (view === "database-detail" && dbActiveTab === "performance" && selectedDatabase) {
+      fetchQueryStats(selectedDatabase.uuid, queryStatsWindow);
+    }
+  }, [view, dbActiveTab, selectedDatabase, queryStatsWindow, fetchQueryStats]);
+
+  // Views that load their own chunk; once opened they stay mounted
+  useEffect(() => {
+    if (view === "static-sites" || view === "ai-builder") {
+      setOpenedViews(prev => (prev.has(view) ? prev : new Set(prev).add(view)));
+    }
+  }, [view]);
+
   // Navigation handlers
   const navigateToScripts = (namespace: string) => {
     setSelectedNamespace(namespace);
+    setScriptQuery((prev) => ({ ...prev, q: "" }));
     setView("scripts");
   };
 
   const navigateToScriptDetail = (scriptName: string) => {
     setSelectedScript(scriptName);
     setActiveTab("overview");
+    setMetrics(null);
     setView("script-detail");
   };
 
@@ -383,6 +518,8 @@ export default function Home() {
     setQueryResults(null);
     setSqlQuery("");
     setQueryError(null);
+    setQueryStats(null);
+    setExpandedFingerprint(null);
     setView("database-detail");
   };
 
@@ -417,7 +554,7 @@ export default function Home() {
       }
       setNewNamespaceName("");
       setShowCreateNamespace(false);
-      fetchNamespaces();
+      namespaceList.reload();
     } catch (err) {
       setError(err instanceof Error ? err.message : "Unknown error");
     } finally {
@@ -434,6 +571,7 @@ export default function Home() {
       formData.append("scriptName", newScriptName.trim());
       formData.append("script", newScriptContent);
       formData.append("mainModule", "index.js");
+      appendUploadOptions(formData, newScriptOptions);
 
       const response = await fetch(`/api/namespaces/${selectedNamespace}/scripts`, {
         method: "PUT",
@@ -444,13 +582,14 @@ export default function Home() {
         throw new Error(data.error || "Failed to upload script");
       }
       setNewScriptName("");
+      setNewScriptOptions({});
       setNewScriptContent(`export default {
   async fetch(request, env, ctx) {
     return new Response("Hello World!");
   },
 };`);
       setShowUploadScript(false);
-      fetchScripts(selectedNamespace);
+      scriptList.reload();
     } catch (err) {
       setError(err instanceof Error ? err.message : "Unknown error");
     } finally {
@@ -658,86 +797,6 @@ export default function Home() {
     }
   };
 
-  // Static site deployment handler
-  const handleDeployStaticSite = async (e: React.FormEvent) => {
-    e.preventDefault();
-    if (!staticSiteName.trim() || !staticSiteHtml.trim() || !staticSiteNamespace) {
-      setError("Please fill in all fields");
-      return;
-    }
-
-    try {
-      setStaticSiteDeploying(true);
-      setStaticSiteUrl(null);
-      setError(null);
-
-      // Generate worker code that serves the HTML
-      const workerCode = `
-// Static Site Worker - Generated by Workers Platform UI
-const HTML_CONTENT = ${JSON.stringify(staticSiteHtml)};
-
-export default {
-  async fetch(request, env, ctx) {
-    const url = new URL(request.url);
-    
-    // Handle CORS preflight
-    if (request.method === "OPTIONS") {
-      return new Response(null, {
-        headers: {
-          "Access-Control-Allow-Origin": "*",
-          "Access-Control-Allow-Methods": "GET, HEAD, OPTIONS",
-          "Access-Control-Allow-Headers": "Content-Type",
-        },
-      });
-    }
-    
-    // Serve the HTML for root or index paths
-    if (url.pathname === "/" || url.pathname === "/index.html") {
-      return new Response(HTML_CONTENT, {
-        headers: {
-          "Content-Type": "text/html;charset=UTF-8",
-          "Cache-Control": "public, max-age=3600",
-          "Access-Control-Allow-Origin": "*",
-        },
-      });
-    }
-    
-    // Return 404 for other paths
-    return new Response("Not Found", { status: 404 });
-  },
-};
-`.trim();
-
-      // Deploy the worker
-      const formData = new FormData();
-      formData.append("scriptName", staticSiteName.trim());
-      formData.append("script", workerCode);
-      formData.append("mainModule", "index.js");
-
-      const response = await fetch(`/api/namespaces/${staticSiteNamespace}/scripts`, {
-        method: "PUT",
-        body: formData,
-      });
-
-      if (!response.ok) {
-        const data = await response.json();
-        throw new Error(data.error || "Failed to deploy static site");
-      }
-
-      // Generate the URL
-      const dispatcherUrl = `https://platform-dispatcher.embitious.workers.dev/${staticSiteName.trim()}`;
-      setStaticSiteUrl(dispatcherUrl);
-      
-      // Clear form
-      setStaticSiteName("");
-      setStaticSiteHtml("");
-    } catch (err) {
-      setError(err instanceof Error ? err.message : "Unknown error");
-    } finally {
-      setStaticSiteDeploying(false);
-    }
-  };
-
   // Database handlers
   const handleCreateDatabase = async (e: React.FormEvent) => {
     e.preventDefault();
@@ -755,7 +814,7 @@ export default {
       }
       setNewDatabaseName("");
       setShowCreateDatabase(false);
-      fetchDatabases();
+      databaseList.reload();
     } catch (err) {
       setError(err instanceof Error ? err.message : "Unknown error");
     } finally {
@@ -898,11 +957,11 @@ export default {
 
       setShowDeleteConfirm(null);
       if (showDeleteConfirm.type === "namespace") {
-        fetchNamespaces();
+        namespaceList.reload();
       } else if (showDeleteConfirm.type === "script" && selectedNamespace) {
-        fetchScripts(selectedNamespace);
+        scriptList.reload();
       } else if (showDeleteConfirm.type === "database") {
-        fetchDatabases();
+        databaseList.reload();
       } else if (selectedNamespace && selectedScript) {
         fetchScriptDetails(selectedNamespace, selectedScript);
       }
@@ -925,99 +984,124 @@ export default {
 
   // Selection handlers
   const toggleNamespaceSelection = (name: string) => {
-    setSelectedNamespaces(prev => {
-      const newSet = new Set(prev);
-      if (newSet.has(name)) {
-        newSet.delete(name);
-      } else {
-        newSet.add(name);
-      }
-      return newSet;
-    });
+    setSelectedNamespaces(prev => toggleSelection(prev, name));
   };
 
   const toggleScriptSelection = (id: string) => {
-    setSelectedScripts(prev => {
-      const newSet = new Set(prev);
-      if (newSet.has(id)) {
-        newSet.delete(id);
-      } else {
-        newSet.add(id);
-      }
-      return newSet;
-    });
+    setSelectedScripts(prev => toggleSelection(prev, id));
   };
 
+  // Selects everything matching the current search, loaded or not
   const selectAllNamespaces = () => {
-    if (selectedNamespaces.size === namespaces.length) {
-      setSelectedNamespaces(new Set());
+    if (selectionCount(selectedNamespaces, namespaceList.total) === namespaceList.total) {
+      setSelectedNamespaces(emptySelection());
     } else {
-      setSelectedNamespaces(new Set(namespaces.map(ns => ns.namespace_name)));
+      setSelectedNamespaces(selectAllMatching());
     }
   };
 
   const selectAllScripts = () => {
-    if (selectedScripts.size === scripts.length) {
-      setSelectedScripts(new Set());
+    if (selectionCount(selectedScripts, scriptList.total) === scriptList.total) {
+      setSelectedScripts(emptySelection());
     } else {
-      setSelectedScripts(new Set(scripts.map(s => s.id)));
+      setSelectedScripts(selectAllMatching());
+    }
+  };
+
+  // Resolve the selection into concrete ids before asking for confirmation,
+  // so "select all matching" deletes exactly what the dialog listed and not
+  // whatever matches by the time the user clicks Delete
+  const openBulkDelete = async () => {
+    const isNamespaceView = view === "namespaces";
+    if (!isNamespaceView && !scriptsUrl) return;
+
+    const request = ++bulkResolveRequest.current;
+    setBulkDeleteIds(null);
+    setShowBulkDeleteConfirm(true);
+    try {
+      const ids = isNamespaceView
+        ? await resolveSelection<Namespace>(selectedNamespaces, namespacesUrl, namespaceQuery, ns => ns.namespace_name)
+        : await resolveSelection<Script>(selectedScripts, scriptsUrl!, scriptQuery, script => script.id);
+      if (request === bulkResolveRequest.current) setBulkDeleteIds(ids);
+    } catch (err) {
+      if (request !== bulkResolveRequest.current) return;
+      setError(err instanceof Error ? err.message : "Unknown error");
+      setShowBulkDeleteConfirm(false);
     }
   };
 
+  const closeBulkDelete = () => {
+    bulkResolveRequest.current++;
+    setShowBulkDeleteConfirm(false);
+    setBulkDeleteIds(null);
+  };
+
   const handleBulkDelete = async () => {
     const isNamespaceView = view === "namespaces";
-    const itemsToDelete = isNamespaceView 
-      ? Array.from(selectedNamespaces) 
-      : Array.from(selectedScripts);
-    
-    if (itemsToDelete.length === 0) return;
+    const itemsToDelete = bulkDeleteIds;
+    if (!itemsToDelete || itemsToDelete.length === 0) return;
 
     try {
       setSubmitting(true);
       setBulkDeleteProgress({ current: 0, total: itemsToDelete.length });
 
-      for (let i = 0; i < itemsToDelete.length; i++) {
-        const item = itemsToDelete[i];
-        let url = "";
-        
-        if (isNamespaceView) {
-          url = `/api/namespaces/${item}`;
-        } else if (selectedNamespace) {
-          url = `/api/namespaces/${selectedNamespace}/scripts/${item}`;
-        }
+      // A few deletes in flight at once; the first failure stops the rest
+      let next = 0;
+      let done = 0;
+      const worker = async () => {
+        while (next < itemsToDelete.length) {
+          const item = itemsToDelete[next++];
+          const url = isNamespaceView
+            ? `/api/namespaces/${item}`
+            : `/api/namespaces/${selectedNamespace}/scripts/${item}`;
+
+          const response = await fetch(url, { method: "DELETE" });
+          if (!response.ok) {
+            next = itemsToDelete.length;
+            const data = await response.json();
+            throw new Error(data.error || `Failed to delete ${item}`);
+          }
 
-        const response = await fetch(url, { method: "DELETE" });
-        if (!response.ok) {
-          const data = await response.json();
-          throw new Error(data.error || `Failed to delete ${item}`);
+          setBulkDeleteProgress({ current: ++done, total: itemsToDelete.length });
         }
-        
-        setBulkDeleteProgress({ current: i + 1, total: itemsToDelete.length });
-      }
+      };
+      await Promise.all(Array.from({ length: Math.min(4, itemsToDelete.length) }, worker));
 
       // Clear selections and refresh
       if (isNamespaceView) {
-        setSelectedNamespaces(new Set());
-        fetchNamespaces();
-      } else if (selectedNamespace) {
-        setSelectedScripts(new Set());
-        fetchScripts(selectedNamespace);
+        setSelectedNamespaces(emptySelection());
+        namespaceList.reload();
+      } else {
+        setSelectedScripts(emptySelection());
+        scriptList.reload();
       }
-      
-      setShowBulkDeleteConfirm(false);
+
+      closeBulkDelete();
     } catch (err) {
       setError(err instanceof Error ? err.message : "Unknown error");
+      if (isNamespaceView) namespaceList.reload();
+      else scriptList.reload();
     } finally {
       setSubmitting(false);
       setBulkDeleteProgress(null);
     }
   };
 
-  // Clear selections when changing views
+  const bulkSelection = view === "namespaces" ? selectedNamespaces : selectedScripts;
+  const bulkQuery = view === "namespaces" ? namespaceQuery : scriptQuery;
+  const bulkSelectionCount = selectionCount(
+    bulkSelection,
+    view === "namespaces" ? namespaceList.total : scriptList.total
+  );
+
+  // Clear selections when changing views or the search/sort behind them
   useEffect(() => {
-    setSelectedNamespaces(new Set());
-    setSelectedScripts(new Set());
-  }, [view]);
+    setSelectedNamespaces(emptySelection());
+  }, [view, namespaceQuery]);
+
+  useEffect(() => {
+    setSelectedScripts(emptySelection());
+  }, [view, selectedNamespace, scriptQuery]);
 
   return (
     <div className="min-h-screen bg-[#0d0d0d] text-white">
@@ -1059,6 +1143,7 @@ export default {
               <div className="flex gap-1 p-1 bg-white/5 rounded-lg mr-4">
                 <button
                   onClick={() => setView("ai-builder")}
+                  onMouseEnter={() => loadAIBuilder()}
                   className={`px-3 py-1.5 text-sm font-medium rounded-md transition-all ${
                     view === "ai-builder" ? "bg-gradient-to-r from-cyan-500 to-blue-500 text-white" : "text-white/50 hover:text-white"
                   }`}
@@ -1083,6 +1168,7 @@ export default {
                 </button>
                 <button
                   onClick={() => setView("static-sites")}
+                  onMouseEnter={() => loadStaticSites()}
                   className={`px-3 py-1.5 text-sm font-medium rounded-md transition-all ${
                     view === "static-sites" ? "bg-white text-black" : "text-white/50 hover:text-white"
                   }`}
@@ -1149,129 +1235,106 @@ export default {
                 <p className="text-white/50 text-sm">Manage your Workers for Platforms dispatch namespaces</p>
               </div>
             </div>
-            
+
+            <ListToolbar
+              query={namespaceQuery}
+              onChange={setNamespaceQuery}
+              placeholder="Search namespaces"
+              sortOptions={[
+                { value: "name", label: "Name" },
+                { value: "created_on", label: "Created" },
+                { value: "script_count", label: "Scripts" },
+              ]}
+              loading={namespaceList.loading}
+            />
+
             {/* Selection Bar */}
-            {namespaces.length > 0 && (
-              <div className="flex items-center gap-4 mb-4 p-3 bg-white/[0.02] border border-white/5 rounded-xl">
-                <label className="flex items-center gap-3 cursor-pointer select-none">
-                  <div className="relative">
-                    <input
-                      type="checkbox"
-                      checked={selectedNamespaces.size === namespaces.length && namespaces.length > 0}
-                      onChange={selectAllNamespaces}
-                      className="peer sr-only"
-                    />
-                    <div className="w-5 h-5 border-2 border-white/20 rounded-md peer-checked:border-orange-500 peer-checked:bg-orange-500 transition-all flex items-center justify-center">
-                      {selectedNamespaces.size === namespaces.length && namespaces.length > 0 && (
-                        <svg className="w-3 h-3 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor" strokeWidth={3}>
-                          <path strokeLinecap="round" strokeLinejoin="round" d="M5 13l4 4L19 7" />
-                        </svg>
-                      )}
-                      {selectedNamespaces.size > 0 && selectedNamespaces.size < namespaces.length && (
-                        <div className="w-2.5 h-0.5 bg-orange-500 rounded" />
-                      )}
-                    </div>
-                  </div>
-                  <span className="text-sm text-white/60">
-                    {selectedNamespaces.size === 0 
-                      ? "Select all" 
-                      : `${selectedNamespaces.size} of ${namespaces.length} selected`}
-                  </span>
-                </label>
-                {selectedNamespaces.size > 0 && (
-                  <button
-                    onClick={() => setShowBulkDeleteConfirm(true)}
-                    className="ml-auto px-4 py-2 text-sm font-medium bg-red-500/10 text-red-400 hover:bg-red-500/20 rounded-lg transition-all flex items-center gap-2"
-                  >
-                    <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                      <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
-                    </svg>
-                    Delete Selected
-                  </button>
-                )}
-              </div>
+            {namespaceList.total > 0 && (
+              <SelectionBar
+                selection={selectedNamespaces}
+                total={namespaceList.total}
+                onToggleAll={selectAllNamespaces}
+                onDelete={openBulkDelete}
+              />
             )}
 
-            <div className="grid gap-3">
-              {namespaces.map((ns) => (
-                <div
-                  key={ns.namespace_id}
-                  className={`group p-5 bg-white/[0.02] border rounded-xl hover:bg-white/[0.04] transition-all cursor-pointer ${
-                    selectedNamespaces.has(ns.namespace_name) 
-                      ? "border-orange-500/50 bg-orange-500/5" 
-                      : "border-white/5 hover:border-white/10"
-                  }`}
-                >
-                  <div className="flex items-start gap-4">
-                    {/* Checkbox */}
-                    <div 
-                      className="pt-0.5"
-                      onClick={(e) => {
-                        e.stopPropagation();
-                        toggleNamespaceSelection(ns.namespace_name);
-                      }}
+            {!namespaceList.loaded ? (
+              <div className="flex items-center justify-center py-20">
+                <div className="w-6 h-6 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+              </div>
+            ) : namespaceList.total === 0 ? (
+              <div className="text-center py-20 text-white/50 text-sm">
+                {namespaceQuery.q ? `No namespaces match "${namespaceQuery.q}"` : "No namespaces yet"}
+              </div>
+            ) : (
+              <VirtualList
+                items={namespaceList.items}
+                rowHeight={LIST_ROW_HEIGHT}
+                getKey={(ns) => ns.namespace_id}
+                onEndReached={namespaceList.loadMore}
+                renderItem={(ns) => (
+                  <div className="h-full pb-3">
+                    <div
+                      className={`group h-full p-5 bg-white/[0.02] border rounded-xl hover:bg-white/[0.04] transition-all cursor-pointer ${
+                        isSelected(selectedNamespaces, ns.namespace_name)
+                          ? "border-orange-500/50 bg-orange-500/5"
+                          : "border-white/5 hover:border-white/10"
+                      }`}
                     >
-                      <div className="relative">
-                        <input
-                          type="checkbox"
-                          checked={selectedNamespaces.has(ns.namespace_name)}
-                          onChange={() => toggleNamespaceSelection(ns.namespace_name)}
-                          className="peer sr-only"
+                      <div className="flex items-start gap-4">
+                        <RowCheckbox
+                          checked={isSelected(selectedNamespaces, ns.namespace_name)}
+                          onToggle={() => toggleNamespaceSelection(ns.namespace_name)}
                         />
-                        <div className="w-5 h-5 border-2 border-white/20 rounded-md peer-checked:border-orange-500 peer-checked:bg-orange-500 transition-all flex items-center justify-center hover:border-white/40">
-                          {selectedNamespaces.has(ns.namespace_name) && (
-                            <svg className="w-3 h-3 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor" strokeWidth={3}>
-                              <path strokeLinecap="round" strokeLinejoin="round" d="M5 13l4 4L19 7" />
+
+                        <div
+                          className="flex-1 min-w-0"
+                          onClick={() => navigateToScripts(ns.namespace_name)}
+                        >
+                          <div className="flex items-center gap-3 mb-3">
+                            <h3 className="font-mono text-base font-medium truncate">{ns.namespace_name}</h3>
+                            <span className="px-2 py-0.5 text-xs font-medium bg-orange-500/10 text-orange-400 rounded-full shrink-0">
+                              {ns.script_count} scripts
+                            </span>
+                          </div>
+                          <div className="flex gap-x-6 text-xs text-white/40 whitespace-nowrap overflow-hidden">
+                            <span>Created {formatDate(ns.created_on)}</span>
+                            <span className="font-mono text-white/30 truncate max-w-[200px]">{ns.namespace_id}</span>
+                          </div>
+                        </div>
+                        <div className="flex items-center gap-2">
+                          <button
+                            onClick={(e) => {
+                              e.stopPropagation();
+                              setShowDeleteConfirm({ type: "namespace", name: ns.namespace_name });
+                            }}
+                            className="p-2 text-white/30 hover:text-red-400 hover:bg-red-500/10 rounded-lg transition-all opacity-0 group-hover:opacity-100"
+                          >
+                            <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                              <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
                             </svg>
-                          )}
+                          </button>
+                          <svg
+                            className="w-5 h-5 text-white/30 group-hover:text-white/50 transition-colors"
+                            fill="none"
+                            viewBox="0 0 24 24"
+                            stroke="currentColor"
+                            onClick={() => navigateToScripts(ns.namespace_name)}
+                          >
+                            <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 5l7 7-7 7" />
+                          </svg>
                         </div>
                       </div>
                     </div>
-                    
-                    <div 
-                      className="flex-1 min-w-0"
-                      onClick={() => navigateToScripts(ns.namespace_name)}
-                    >
-                      <div className="flex items-center gap-3 mb-3">
-                        <h3 className="font-mono text-base font-medium truncate">{ns.namespace_name}</h3>
-                        <span className="px-2 py-0.5 text-xs font-medium bg-orange-500/10 text-orange-400 rounded-full shrink-0">
-                          {ns.script_count} scripts
-                        </span>
-                      </div>
-                      <div className="flex flex-wrap gap-x-6 gap-y-2 text-xs text-white/40">
-                        <span>Created {formatDate(ns.created_on)}</span>
-                        <span className="font-mono text-white/30 truncate max-w-[200px]">{ns.namespace_id}</span>
-                      </div>
-                    </div>
-                    <div className="flex items-center gap-2">
-                      <button
-                        onClick={(e) => {
-                          e.stopPropagation();
-                          setShowDeleteConfirm({ type: "namespace", name: ns.namespace_name });
-                        }}
-                        className="p-2 text-white/30 hover:text-red-400 hover:bg-red-500/10 rounded-lg transition-all opacity-0 group-hover:opacity-100"
-                      >
-                        <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                          <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
-                        </svg>
-                      </button>
-                      <svg 
-                        className="w-5 h-5 text-white/30 group-hover:text-white/50 transition-colors" 
-                        fill="none" 
-                        viewBox="0 0 24 24" 
-                        stroke="currentColor"
-                        onClick={() => navigateToScripts(ns.namespace_name)}
-                      >
-                        <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 5l7 7-7 7" />
-                      </svg>
-                    </div>
                   </div>
-                </div>
-              ))}
-            </div>
-            {namespaces.length > 0 && (
+                )}
+              />
+            )}
+            {namespaceList.total > 0 && (
               <div className="mt-8 pt-6 border-t border-white/5 text-sm text-white/40">
-                {namespaces.length} namespace{namespaces.length !== 1 ? "s" : ""}
+                {namespaceList.items.length < namespaceList.total
+                  ? `${namespaceList.items.length} of ${namespaceList.total} namespaces loaded`
+                  : `${namespaceList.total} namespace${namespaceList.total !== 1 ? "s" : ""}`}
               </div>
             )}
           </>
@@ -1286,7 +1349,11 @@ export default {
                 <p className="text-white/50 text-sm">Workers in {selectedNamespace}</p>
               </div>
             </div>
-            {scripts.length === 0 ? (
+            {!scriptList.loaded ? (
+              <div className="flex items-center justify-center py-20">
+                <div className="w-6 h-6 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+              </div>
+            ) : scriptList.total === 0 && !scriptQuery.q ? (
               <div className="text-center py-20">
                 <div className="w-16 h-16 mx-auto mb-4 rounded-2xl bg-white/5 flex items-center justify-center">
                   <svg className="w-8 h-8 text-white/30" fill="none" viewBox="0 0 24 24" stroke="currentColor">
@@ -1304,128 +1371,108 @@ export default {
               </div>
             ) : (
               <>
+                <ListToolbar
+                  query={scriptQuery}
+                  onChange={setScriptQuery}
+                  placeholder="Search scripts"
+                  sortOptions={[
+                    { value: "modified_on", label: "Modified" },
+                    { value: "created_on", label: "Created" },
+                    { value: "id", label: "Name" },
+                  ]}
+                  loading={scriptList.loading}
+                />
+
                 {/* Selection Bar */}
-                <div className="flex items-center gap-4 mb-4 p-3 bg-white/[0.02] border border-white/5 rounded-xl">
-                  <label className="flex items-center gap-3 cursor-pointer select-none">
-                    <div className="relative">
-                      <input
-                        type="checkbox"
-                        checked={selectedScripts.size === scripts.length && scripts.length > 0}
-                        onChange={selectAllScripts}
-                        className="peer sr-only"
-                      />
-                      <div className="w-5 h-5 border-2 border-white/20 rounded-md peer-checked:border-orange-500 peer-checked:bg-orange-500 transition-all flex items-center justify-center">
-                        {selectedScripts.size === scripts.length && scripts.length > 0 && (
-                          <svg className="w-3 h-3 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor" strokeWidth={3}>
-                            <path strokeLinecap="round" strokeLinejoin="round" d="M5 13l4 4L19 7" />
-                          </svg>
-                        )}
-                        {selectedScripts.size > 0 && selectedScripts.size < scripts.length && (
-                          <div className="w-2.5 h-0.5 bg-orange-500 rounded" />
-                        )}
-                      </div>
-                    </div>
-                    <span className="text-sm text-white/60">
-                      {selectedScripts.size === 0 
-                        ? "Select all" 
-                        : `${selectedScripts.size} of ${scripts.length} selected`}
-                    </span>
-                  </label>
-                  {selectedScripts.size > 0 && (
-                    <button
-                      onClick={() => setShowBulkDeleteConfirm(true)}
-                      className="ml-auto px-4 py-2 text-sm font-medium bg-red-500/10 text-red-400 hover:bg-red-500/20 rounded-lg transition-all flex items-center gap-2"
-                    >
-                      <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                        <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
-                      </svg>
-                      Delete Selected
-                    </button>
-                  )}
-                </div>
+                {scriptList.total > 0 && (
+                  <SelectionBar
+                    selection={selectedScripts}
+                    total={scriptList.total}
+                    onToggleAll={selectAllScripts}
+                    onDelete={openBulkDelete}
+                  />
+                )}
 
-                <div className="grid gap-3">
-                  {scripts.map((script) => (
-                    <div
-                      key={script.id}
-                      className={`group p-5 bg-white/[0.02] border rounded-xl hover:bg-white/[0.04] transition-all cursor-pointer ${
-                        selectedScripts.has(script.id) 
-                          ? "border-orange-500/50 bg-orange-500/5" 
-                          : "border-white/5 hover:border-white/10"
-                      }`}
-                    >
-                      <div className="flex items-start gap-4">
-                        {/* Checkbox */}
-                        <div 
-                          className="pt-0.5"
-                          onClick={(e) => {
-                            e.stopPropagation();
-                            toggleScriptSelection(script.id);
-                          }}
+                {scriptList.total === 0 ? (
+                  <div className="text-center py-20 text-white/50 text-sm">
+                    No scripts match &quot;{scriptQuery.q}&quot;
+                  </div>
+                ) : (
+                  <VirtualList
+                    items={scriptList.items}
+                    rowHeight={LIST_ROW_HEIGHT}
+                    getKey={(script) => script.id}
+                    onEndReached={scriptList.loadMore}
+                    renderItem={(script) => (
+                      <div className="h-full pb-3">
+                        <div
+                          className={`group h-full p-5 bg-white/[0.02] border rounded-xl hover:bg-white/[0.04] transition-all cursor-pointer ${
+                            isSelected(selectedScripts, script.id)
+                              ? "border-orange-500/50 bg-orange-500/5"
+                              : "border-white/5 hover:border-white/10"
+                          }`}
                         >
-                          <div className="relative">
-                            <input
-                              type="checkbox"
-                              checked={selectedScripts.has(script.id)}
-                              onChange={() => toggleScriptSelection(script.id)}
-                              className="peer sr-only"
+                          <div className="flex items-start gap-4">
+                            <RowCheckbox
+                              checked={isSelected(selectedScripts, script.id)}
+                              onToggle={() => toggleScriptSelection(script.id)}
                             />
-                            <div className="w-5 h-5 border-2 border-white/20 rounded-md peer-checked:border-orange-500 peer-checked:bg-orange-500 transition-all flex items-center justify-center hover:border-white/40">
-                              {selectedScripts.has(script.id) && (
-                                <svg className="w-3 h-3 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor" strokeWidth={3}>
-                                  <path strokeLinecap="round" strokeLinejoin="round" d="M5 13l4 4L19 7" />
+
+                            <div
+                              className="flex-1 min-w-0"
+                              onClick={() => navigateToScriptDetail(script.id)}
+                            >
+                              <div className="flex items-center gap-3 mb-3">
+                                <h3 className="font-mono text-base font-medium truncate">{script.id}</h3>
+                                {script.handlers.map((h) => (
+                                  <span key={h} className="px-2 py-0.5 text-xs font-medium bg-blue-500/10 text-blue-400 rounded-full">
+                                    {h}
+                                  </span>
+                                ))}
+                              </div>
+                              <div className="flex gap-x-6 text-xs text-white/40 whitespace-nowrap overflow-hidden">
+                                <span>Modified {formatDate(script.modified_on)}</span>
+                                <span className="font-mono">{script.compatibility_date}</span>
+                                {script.compatibility_flags.map((f) => (
+                                  <span key={f} className="text-white/30">{f}</span>
+                                ))}
+                              </div>
+                            </div>
+                            <div className="flex items-center gap-2">
+                              <button
+                                onClick={(e) => {
+                                  e.stopPropagation();
+                                  setShowDeleteConfirm({ type: "script", name: script.id });
+                                }}
+                                className="p-2 text-white/30 hover:text-red-400 hover:bg-red-500/10 rounded-lg transition-all opacity-0 group-hover:opacity-100"
+                              >
+                                <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                                  <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
                                 </svg>
-                              )}
+                              </button>
+                              <svg
+                                className="w-5 h-5 text-white/30 group-hover:text-white/50 transition-colors"
+                                fill="none"
+                                viewBox="0 0 24 24"
+                                stroke="currentColor"
+                                onClick={() => navigateToScriptDetail(script.id)}
+                              >
+                                <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 5l7 7-7 7" />
+                              </svg>
                             </div>
                           </div>
                         </div>
-                        
-                        <div 
-                          className="flex-1 min-w-0"
-                          onClick={() => navigateToScriptDetail(script.id)}
-                        >
-                          <div className="flex items-center gap-3 mb-3">
-                            <h3 className="font-mono text-base font-medium truncate">{script.id}</h3>
-                            {script.handlers.map((h) => (
-                              <span key={h} className="px-2 py-0.5 text-xs font-medium bg-blue-500/10 text-blue-400 rounded-full">
-                                {h}
-                              </span>
-                            ))}
-                          </div>
-                          <div className="flex flex-wrap gap-x-6 gap-y-2 text-xs text-white/40">
-                            <span>Modified {formatDate(script.modified_on)}</span>
-                            <span className="font-mono">{script.compatibility_date}</span>
-                            {script.compatibility_flags.map((f) => (
-                              <span key={f} className="text-white/30">{f}</span>
-                            ))}
-                          </div>
-                        </div>
-                        <div className="flex items-center gap-2">
-                          <button
-                            onClick={(e) => {
-                              e.stopPropagation();
-                              setShowDeleteConfirm({ type: "script", name: script.id });
-                            }}
-                            className="p-2 text-white/30 hover:text-red-400 hover:bg-red-500/10 rounded-lg transition-all opacity-0 group-hover:opacity-100"
-                          >
-                            <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                              <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
-                            </svg>
-                          </button>
-                          <svg 
-                            className="w-5 h-5 text-white/30 group-hover:text-white/50 transition-colors" 
-                            fill="none" 
-                            viewBox="0 0 24 24" 
-                            stroke="currentColor"
-                            onClick={() => navigateToScriptDetail(script.id)}
-                          >
-                            <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 5l7 7-7 7" />
-                          </svg>
-                        </div>
                       </div>
-                    </div>
-                  ))}
-                </div>
+                    )}
+                  />
+                )}
+                {scriptList.total > 0 && (
+                  <div className="mt-8 pt-6 border-t border-white/5 text-sm text-white/40">
+                    {scriptList.items.length < scriptList.total
+                      ? `${scriptList.items.length} of ${scriptList.total} scripts loaded`
+                      : `${scriptList.total} script${scriptList.total !== 1 ? "s" : ""}`}
+                  </div>
+                )}
               </>
             )}
           </>
@@ -1441,7 +1488,7 @@ export default {
 
             {/* Tabs */}
             <div className="flex gap-1 mb-6 p-1 bg-white/5 rounded-xl w-fit">
-              {(["overview", "bindings", "secrets", "settings", "tags", "content"] as const).map((tab) => (
+              {(["overview", "metrics", "bindings", "secrets", "settings", "tags", "content"] as const).map((tab) => (
                 <button
                   key={tab}
                   onClick={() => setActiveTab(tab)}
@@ -1514,6 +1561,92 @@ export default {
                 </div>
               )}
 
+              {/* Metrics Tab */}
+              {activeTab === "metrics" && (
+                <div className="space-y-6">
+                  <div className="flex items-center justify-between">
+                    <div>
+                      <h3 className="font-medium">Request Metrics</h3>
+                      <p className="text-xs text-white/40 mt-1">
+                        Recorded by the dispatchers{metrics ? ` · ${metrics.source === "local" ? "local sink" : "Analytics Engine"}` : ""}
+                      </p>
+                    </div>
+                    <div className="flex items-center gap-2">
+                      <div className="flex gap-1 p-1 bg-white/5 rounded-lg">
+                        {(["1h", "24h", "7d"] as const).map((w) => (
+                          <button
+                            key={w}
+                            onClick={() => setMetricsWindow(w)}
+                            className={`px-3 py-1 text-xs font-medium rounded-md transition-all ${
+                              metricsWindow === w ? "bg-white text-black" : "text-white/50 hover:text-white"
+                            }`}
+                          >
+                            {w}
+                          </button>
+                        ))}
+                      </div>
+                      <button
+                        onClick={() => selectedNamespace && selectedScript && fetchMetrics(selectedNamespace, selectedScript, metricsWindow)}
+                        disabled={metricsLoading}
+                        className="px-3 py-1.5 text-xs font-medium bg-white/5 hover:bg-white/10 rounded-lg transition-all disabled:opacity-50"
+                      >
+                        {metricsLoading ? "Loading..." : "Refresh"}
+                      </button>
+                    </div>
+                  </div>
+
+                  {metricsLoading && !metrics ? (
+                    <div className="flex items-center justify-center py-10">
+                      <div className="w-6 h-6 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+                    </div>
+                  ) : !metrics || metrics.summary.requests === 0 ? (
+                    <p className="text-white/40 text-sm">No requests recorded in the last {metricsWindow}</p>
+                  ) : (
+                    <>
+                      <div className="grid grid-cols-3 md:grid-cols-6 gap-3">
+                        {[
+                          { label: "Requests", value: metrics.summary.requests.toLocaleString() },
+                          { label: "Req / min", value: (metrics.summary.requests / (METRICS_WINDOW_SECONDS[metrics.window] / 60)).toFixed(2) },
+                          { label: "Error rate", value: `${(metrics.summary.errorRate * 100).toFixed(2)}%`, alert: metrics.summary.errorRate > 0.01 },
+                          { label: "p50", value: `${metrics.summary.p50.toFixed(0)} ms` },
+                          { label: "p95", value: `${metrics.summary.p95.toFixed(0)} ms` },
+                          { label: "p99", value: `${metrics.summary.p99.toFixed(0)} ms` },
+                        ].map(({ label, value, alert }) => (
+                          <div key={label} className="p-3 bg-white/[0.02] border border-white/5 rounded-lg">
+                            <label className="text-xs text-white/40 uppercase tracking-wider">{label}</label>
+                            <p className={`font-mono mt-1 ${alert ? "text-red-400" : ""}`}>{value}</p>
+                          </div>
+                        ))}
+                      </div>
+
+                      <MetricsChart
+                        title="Latency"
+                        series={metrics.series}
+                        lines={[
+                          { key: "p50", label: "p50", color: "#34d399" },
+                          { key: "p95", label: "p95", color: "#fbbf24" },
+                          { key: "p99", label: "p99", color: "#f87171" },
+                        ]}
+                        unit="ms"
+                      />
+                      <MetricsChart
+                        title={`Throughput (requests per ${metrics.bucketSeconds >= 3600 ? `${metrics.bucketSeconds / 3600}h` : `${metrics.bucketSeconds / 60}m`})`}
+                        series={metrics.series}
+                        lines={[
+                          { key: "requests", label: "requests", color: "#60a5fa" },
+                          { key: "errors", label: "5xx", color: "#f87171" },
+                        ]}
+                      />
+
+                      <div className="flex gap-6 text-xs text-white/40">
+                        <span>In: {(metrics.summary.bytesIn / 1024).toFixed(1)} KB</span>
+                        <span>Out: {(metrics.summary.bytesOut / 1024).toFixed(1)} KB</span>
+                      </div>
+                    </>
+                  )}
+                </div>
+              )}
+
               {/* Bindings Tab */}
               {activeTab === "bindings" && (
                 <div>
@@ -1669,6 +1802,10 @@ export default {
                       <label className="text-xs text-white/40 uppercase tracking-wider">Placement</label>
                       <p className="mt-1 capitalize">{settings.placement?.mode || "None"}</p>
                     </div>
+                    <div>
+                      <label className="text-xs text-white/40 uppercase tracking-wider">CPU Limit</label>
+                      <p className="mt-1">{settings.limits?.cpu_ms ? `${settings.limits.cpu_ms.toLocaleString()} ms` : "Default"}</p>
+                    </div>
                   </div>
                   <div>
                     <label className="text-xs text-white/40 uppercase tracking-wider">Compatibility Flags</label>
@@ -1799,7 +1936,11 @@ export default {
               </div>
             </div>
 
-            {databases.length === 0 ? (
+            {!databaseList.loaded ? (
+              <div className="flex items-center justify-center py-20">
+                <div className="w-6 h-6 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+              </div>
+            ) : databaseList.total === 0 && !databaseQuery.q ? (
               <div className="text-center py-20">
                 <div className="w-16 h-16 mx-auto mb-4 rounded-2xl bg-white/5 flex items-center justify-center">
                   <svg className="w-8 h-8 text-white/30" fill="none" viewBox="0 0 24 24" stroke="currentColor">
@@ -1816,56 +1957,84 @@ export default {
                 </button>
               </div>
             ) : (
-              <div className="grid gap-3">
-                {databases.map((db) => (
-                  <div
-                    key={db.uuid}
-                    onClick={() => navigateToDatabaseDetail(db)}
-                    className="group p-5 bg-white/[0.02] border border-white/5 rounded-xl hover:bg-white/[0.04] hover:border-white/10 transition-all cursor-pointer"
-                  >
-                    <div className="flex items-start gap-4">
-                      <div className="w-10 h-10 rounded-lg bg-cyan-500/10 flex items-center justify-center shrink-0">
-                        <svg className="w-5 h-5 text-cyan-400" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                          <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M4 7v10c0 2.21 3.582 4 8 4s8-1.79 8-4V7M4 7c0 2.21 3.582 4 8 4s8-1.79 8-4M4 7c0-2.21 3.582-4 8-4s8 1.79 8 4m0 5c0 2.21-3.582 4-8 4s-8-1.79-8-4" />
-                        </svg>
-                      </div>
-                      <div className="flex-1 min-w-0">
-                        <div className="flex items-center gap-3 mb-3">
-                          <h3 className="font-mono text-base font-medium truncate">{db.name}</h3>
-                          <span className="px-2 py-0.5 text-xs font-medium bg-cyan-500/10 text-cyan-400 rounded-full shrink-0">
-                            {db.num_tables} tables
-                          </span>
-                        </div>
-                        <div className="flex flex-wrap gap-x-6 gap-y-2 text-xs text-white/40">
-                          <span>Created {formatDate(db.created_at)}</span>
-                          <span>{(db.file_size / 1024).toFixed(1)} KB</span>
-                          <span className="font-mono text-white/30 truncate max-w-[200px]">{db.uuid}</span>
-                        </div>
-                      </div>
-                      <div className="flex items-center gap-2">
-                        <button
-                          onClick={(e) => {
-                            e.stopPropagation();
-                            setShowDeleteConfirm({ type: "database", name: db.name, id: db.uuid });
-                          }}
-                          className="p-2 text-white/30 hover:text-red-400 hover:bg-red-500/10 rounded-lg transition-all opacity-0 group-hover:opacity-100"
+              <>
+                <ListToolbar
+                  query={databaseQuery}
+                  onChange={setDatabaseQuery}
+                  placeholder="Search databases"
+                  sortOptions={[
+                    { value: "name", label: "Name" },
+                    { value: "created_at", label: "Created" },
+                    { value: "file_size", label: "Size" },
+                    { value: "num_tables", label: "Tables" },
+                  ]}
+                  loading={databaseList.loading}
+                />
+
+                {databaseList.total === 0 ? (
+                  <div className="text-center py-20 text-white/50 text-sm">
+                    No databases match &quot;{databaseQuery.q}&quot;
+                  </div>
+                ) : (
+                  <VirtualList
+                    items={databaseList.items}
+                    rowHeight={LIST_ROW_HEIGHT}
+                    getKey={(db) => db.uuid}
+                    onEndReached={databaseList.loadMore}
+                    renderItem={(db) => (
+                      <div className="h-full pb-3">
+                        <div
+                          onClick={() => navigateToDatabaseDetail(db)}
+                          className="group h-full p-5 bg-white/[0.02] border border-white/5 rounded-xl hover:bg-white/[0.04] hover:border-white/10 transition-all cursor-pointer"
                         >
-                          <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                            <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
-                          </svg>
-                        </button>
-                        <svg className="w-5 h-5 text-white/30 group-hover:text-white/50 transition-colors" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                          <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 5l7 7-7 7" />
-                        </svg>
+                          <div className="flex items-start gap-4">
+                            <div className="w-10 h-10 rounded-lg bg-cyan-500/10 flex items-center justify-center shrink-0">
+                              <svg className="w-5 h-5 text-cyan-400" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                                <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M4 7v10c0 2.21 3.582 4 8 4s8-1.79 8-4V7M4 7c0 2.21 3.582 4 8 4s8-1.79 8-4M4 7c0-2.21 3.582-4 8-4s8 1.79 8 4m0 5c0 2.21-3.582 4-8 4s-8-1.79-8-4" />
+                              </svg>
+                            </div>
+                            <div className="flex-1 min-w-0">
+                              <div className="flex items-center gap-3 mb-3">
+                                <h3 className="font-mono text-base font-medium truncate">{db.name}</h3>
+                                <span className="px-2 py-0.5 text-xs font-medium bg-cyan-500/10 text-cyan-400 rounded-full shrink-0">
+                                  {db.num_tables} tables
+                                </span>
+                              </div>
+                              <div className="flex gap-x-6 text-xs text-white/40 whitespace-nowrap overflow-hidden">
+                                <span>Created {formatDate(db.created_at)}</span>
+                                <span>{(db.file_size / 1024).toFixed(1)} KB</span>
+                                <span className="font-mono text-white/30 truncate max-w-[200px]">{db.uuid}</span>
+                              </div>
+                            </div>
+                            <div className="flex items-center gap-2">
+                              <button
+                                onClick={(e) => {
+                                  e.stopPropagation();
+                                  setShowDeleteConfirm({ type: "database", name: db.name, id: db.uuid });
+                                }}
+                                className="p-2 text-white/30 hover:text-red-400 hover:bg-red-500/10 rounded-lg transition-all opacity-0 group-hover:opacity-100"
+                              >
+                                <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                                  <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
+                                </svg>
+                              </button>
+                              <svg className="w-5 h-5 text-white/30 group-hover:text-white/50 transition-colors" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+                                <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 5l7 7-7 7" />
+                              </svg>
+                            </div>
+                          </div>
+                        </div>
                       </div>
-                    </div>
-                  </div>
-                ))}
-              </div>
+                    )}
+                  />
+                )}
+              </>
             )}
-            {databases.length > 0 && (
+            {databaseList.total > 0 && (
               <div className="mt-8 pt-6 border-t border-white/5 text-sm text-white/40">
-                {databases.length} database{databases.length !== 1 ? "s" : ""}
+                {databaseList.items.length < databaseList.total
+                  ? `${databaseList.items.length} of ${databaseList.total} databases loaded`
+                  : `${databaseList.total} database${databaseList.total !== 1 ? "s" : ""}`}
               </div>
             )}
           </>
@@ -1881,7 +2050,7 @@ export default {
 
             {/* Database Tabs */}
             <div className="flex gap-1 mb-6 p-1 bg-white/5 rounded-xl w-fit">
-              {(["tables", "query", "schema"] as const).map((tab) => (
+              {(["tables", "query", "performance", "schema"] as const).map((tab) => (
                 <button
                   key={tab}
                   onClick={() => setDbActiveTab(tab)}
@@ -2071,6 +2240,136 @@ export default {
                 </div>
               )}
 
+              {/* Performance Tab */}
+              {dbActiveTab === "performance" && (
+                <div className="space-y-6">
+                  <div className="flex items-center justify-between">
+                    <div>
+                      <h3 className="font-medium">Slow Queries</h3>
+                      <p className="text-xs text-white/40 mt-1">
+                        Statements run from this dashboard, grouped by fingerprint · most total time first
+                      </p>
+                    </div>
+                    <div className="flex items-center gap-2">
+                      <div className="flex gap-1 p-1 bg-white/5 rounded-lg">
+                        {(["1h", "24h", "7d"] as const).map((w) => (
+                          <button
+                            key={w}
+                            onClick={() => setQueryStatsWindow(w)}
+                            className={`px-3 py-1 text-xs font-medium rounded-md transition-all ${
+                              queryStatsWindow === w ? "bg-white text-black" : "text-white/50 hover:text-white"
+                            }`}
+                          >
+                            {w}
+                          </button>
+                        ))}
+                      </div>
+                      <button
+                        onClick={() => selectedDatabase && fetchQueryStats(selectedDatabase.uuid, queryStatsWindow)}
+                        disabled={queryStatsLoading}
+                        className="px-3 py-1.5 text-xs font-medium bg-white/5 hover:bg-white/10 rounded-lg transition-all disabled:opacity-50"
+                      >
+                        {queryStatsLoading ? "Loading..." : "Refresh"}
+                      </button>
+                    </div>
+                  </div>
+
+                  {queryStatsLoading && !queryStats ? (
+                    <div className="flex items-center justify-center py-10">
+                      <div className="w-6 h-6 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+                    </div>
+                  ) : !queryStats || queryStats.fingerprints.length === 0 ? (
+                    <p className="text-white/40 text-sm">No queries recorded in the last {queryStatsWindow}</p>
+                  ) : (
+                    <div className="overflow-x-auto rounded-lg border border-white/10">
+                      <table className="w-full text-sm">
+                        <thead>
+                          <tr className="bg-white/5">
+                            {["Query", "Calls", "p50", "p95", "Max", "Rows read", "Read / returned", "p95 trend"].map((col) => (
+                              <th key={col} className="px-4 py-2 text-left text-xs text-white/50 font-medium border-b border-white/10 whitespace-nowrap">
+                                {col}
+                              </th>
+                            ))}
+                          </tr>
+                        </thead>
+                        <tbody>
+                          {queryStats.fingerprints.map((f) => {
+                            const scanRatio = f.avgRowsRead / Math.max(1, f.avgRowsReturned + f.avgRowsWritten);
+                            const expanded = expandedFingerprint === f.fingerprint;
+                            return (
+                              <Fragment key={f.fingerprint}>
+                                <tr
+                                  onClick={() => setExpandedFingerprint(expanded ? null : f.fingerprint)}
+                                  className="border-b border-white/5 hover:bg-white/[0.02] cursor-pointer"
+                                >
+                                  <td className="px-4 py-2 font-mono text-xs text-white/70 max-w-md truncate" title={f.sql}>
+                                    {f.sql}
+                                  </td>
+                                  <td className="px-4 py-2 font-mono text-xs text-white/70">{f.calls.toLocaleString()}</td>
+                                  <td className="px-4 py-2 font-mono text-xs text-white/70">{f.p50.toFixed(2)} ms</td>
+                                  <td className="px-4 py-2 font-mono text-xs text-white/70">{f.p95.toFixed(2)} ms</td>
+                                  <td className="px-4 py-2 font-mono text-xs text-white/70">{f.maxMs.toFixed(2)} ms</td>
+                                  <td className="px-4 py-2 font-mono text-xs text-white/70">{Math.round(f.avgRowsRead).toLocaleString()}</td>
+                                  <td className="px-4 py-2 font-mono text-xs">
+                                    <span
+                                      className={scanRatio >= SCAN_RATIO_WARNING ? "text-amber-400" : "text-white/70"}
+                                      title={scanRatio >= SCAN_RATIO_WARNING ? "Scans far more rows than it returns; check for a missing index" : undefined}
+                                    >
+                                      {scanRatio.toFixed(scanRatio < 10 ? 1 : 0)}×
+                                    </span>
+                                  </td>
+                                  <td className="px-4 py-2 font-mono text-xs">
+                                    {f.p95Change === null ? (
+                                      <span className="text-white/30">—</span>
+                                    ) : (
+                                      <span className={f.p95Change >= REGRESSION_WARNING ? "text-red-400" : f.p95Change <= -REGRESSION_WARNING ? "text-emerald-400" : "text-white/70"}>
+                                        {f.p95Change >= 0 ? "+" : ""}{(f.p95Change * 100).toFixed(0)}%
+                                      </span>
+                                    )}
+                                  </td>
+                                </tr>
+                                {expanded && (
+                                  <tr className="border-b border-white/5">
+                                    <td colSpan={8} className="p-4 space-y-4">
+                                      <pre className="p-3 bg-black/50 border border-white/10 rounded-lg font-mono text-xs text-white/70 whitespace-pre-wrap break-all">
+                                        {f.sql}
+                                      </pre>
+                                      <div className="flex gap-6 text-xs text-white/40">
+                                        <span>Total: {f.totalMs.toFixed(1)} ms</span>
+                                        <span>Rows written / call: {f.avgRowsWritten.toFixed(1)}</span>
+                                        <span>Rows returned / call: {f.avgRowsReturned.toFixed(1)}</span>
+                                        <span>Last seen: {new Date(f.lastSeen).toLocaleString()}</span>
+                                      </div>
+                                      <div className="grid md:grid-cols-2 gap-4">
+                                        <MetricsChart
+                                          title="Latency"
+                                          series={f.trend}
+                                          lines={[
+                                            { key: "p50", label: "p50", color: "#34d399" },
+                                            { key: "p95", label: "p95", color: "#fbbf24" },
+                                          ]}
+                                          unit="ms"
+                                        />
+                                        <MetricsChart
+                                          title="Rows read per call"
+                                          series={f.trend}
+                                          lines={[{ key: "rowsRead", label: "rows read", color: "#60a5fa" }]}
+                                        />
+                                      </div>
+                                      <DurationHistogram counts={f.histogram} bucketsMs={queryStats.durationBucketsMs} />
+                                    </td>
+                                  </tr>
+                                )}
+                              </Fragment>
+                            );
+                          })}
+                        </tbody>
+                      </table>
+                    </div>
+                  )}
+                </div>
+              )}
+
               {/* Schema Builder Tab */}
               {dbActiveTab === "schema" && (
                 <div>
@@ -2213,235 +2512,24 @@ export default {
           </>
         )}
 
-        {/* Static Sites View */}
-        {!loading && view === "static-sites" && (
-          <>
-            <div className="mb-8 flex items-start justify-between gap-4">
-              <div>
-                <h2 className="text-2xl font-semibold tracking-tight mb-2">Static Sites</h2>
-                <p className="text-white/50 text-sm">Deploy HTML pages as Workers</p>
-              </div>
-            </div>
-
-            <div className="grid grid-cols-1 lg:grid-cols-2 gap-6">
-              {/* Deploy Form */}
-              <div className="card bg-white/[0.02] border border-white/5 rounded-xl p-6">
-                <div className="flex items-center gap-3 mb-6">
-                  <div className="w-10 h-10 rounded-lg bg-gradient-to-br from-pink-500 to-rose-600 flex items-center justify-center">
-                    <svg className="w-5 h-5 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                      <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M4 16l4.586-4.586a2 2 0 012.828 0L16 16m-2-2l1.586-1.586a2 2 0 012.828 0L20 14m-6-6h.01M6 20h12a2 2 0 002-2V6a2 2 0 00-2-2H6a2 2 0 00-2 2v12a2 2 0 002 2z" />
-                    </svg>
-                  </div>
-                  <div>
-                    <h3 className="font-semibold">Deploy Static Site</h3>
-                    <p className="text-xs text-white/40">Paste your HTML and deploy instantly</p>
-                  </div>
-                </div>
-
-                <form onSubmit={handleDeployStaticSite}>
-                  <div className="mb-4">
-                    <label className="block text-sm font-medium mb-2 text-white/70">Namespace</label>
-                    <select
-                      value={staticSiteNamespace}
-                      onChange={(e) => setStaticSiteNamespace(e.target.value)}
-                      className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white focus:outline-none focus:ring-2 focus:ring-pink-500/50"
-                      required
-                    >
-                      <option value="">Select a namespace...</option>
-                      {namespaces.map((ns) => (
-                        <option key={ns.namespace_id} value={ns.namespace_name}>
-                          {ns.namespace_name}
-                        </option>
-                      ))}
-                    </select>
-                  </div>
-
-                  <div className="mb-4">
-                    <label className="block text-sm font-medium mb-2 text-white/70">Site Name</label>
-                    <input
-                      type="text"
-                      value={staticSiteName}
-                      onChange={(e) => setStaticSiteName(e.target.value)}
-                      placeholder="my-static-site"
-                      className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white placeholder:text-white/30 focus:outline-none focus:ring-2 focus:ring-pink-500/50 font-mono text-sm"
-                      required
-                    />
-                    <p className="text-xs text-white/40 mt-1">
-                      URL will be: https://platform-dispatcher.embitious.workers.dev/{staticSiteName || "site-name"}
-                    </p>
-                  </div>
-
-                  <div className="mb-6">
-                    <label className="block text-sm font-medium mb-2 text-white/70">HTML Content</label>
-                    <div className="border border-white/10 rounded-xl overflow-hidden">
-                      <Editor
-                        height="400px"
-                        defaultLanguage="html"
-                        value={staticSiteHtml}
-                        onChange={(value) => setStaticSiteHtml(value || "")}
-                        theme="vs-dark"
-                        options={{
-                          minimap: { enabled: false },
-                          fontSize: 12,
-                          lineNumbers: "on",
-                          scrollBeyondLastLine: false,
-                          wordWrap: "on",
-                          folding: true,
-                          automaticLayout: true,
-                          padding: { top: 12, bottom: 12 },
-                          tabSize: 2,
-                        }}
-                      />
-                    </div>
-                    <p className="text-xs text-white/40 mt-2">
-                      {staticSiteHtml.length.toLocaleString()} characters
-                    </p>
-                  </div>
-
-                  <button
-                    type="submit"
-                    disabled={staticSiteDeploying || !staticSiteName.trim() || !staticSiteHtml.trim() || !staticSiteNamespace}
-                    className="w-full px-4 py-3 text-sm font-medium bg-gradient-to-r from-pink-500 to-rose-500 text-white rounded-xl disabled:opacity-50 transition-all hover:shadow-lg hover:shadow-pink-500/20 flex items-center justify-center gap-2"
-                  >
-                    {staticSiteDeploying ? (
-                      <>
-                        <div className="w-4 h-4 border-2 border-white/30 border-t-white rounded-full animate-spin" />
-                        Deploying...
-                      </>
-                    ) : (
-                      <>
-                        <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                          <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M7 16a4 4 0 01-.88-7.903A5 5 0 1115.9 6L16 6a5 5 0 011 9.9M15 13l-3-3m0 0l-3 3m3-3v12" />
-                        </svg>
-                        Deploy Static Site
-                      </>
-                    )}
-                  </button>
-                </form>
-
-                {/* Success Message */}
-                {staticSiteUrl && (
-                  <div className="mt-6 p-4 bg-emerald-500/10 border border-emerald-500/20 rounded-xl">
-                    <div className="flex items-center gap-2 mb-2">
-                      <svg className="w-5 h-5 text-emerald-400" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                        <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M9 12l2 2 4-4m6 2a9 9 0 11-18 0 9 9 0 0118 0z" />
-                      </svg>
-                      <span className="text-emerald-400 font-medium">Deployed Successfully!</span>
-                    </div>
-                    <p className="text-sm text-white/60 mb-3">Your static site is now live at:</p>
-                    <a
-                      href={staticSiteUrl}
-                      target="_blank"
-                      rel="noopener noreferrer"
-                      className="block p-3 bg-black/30 rounded-lg font-mono text-sm text-pink-400 hover:text-pink-300 break-all"
-                    >
-                      {staticSiteUrl}
-                    </a>
-                    <button
-                      onClick={() => window.open(staticSiteUrl, "_blank")}
-                      className="mt-3 w-full px-4 py-2 text-sm font-medium bg-white/5 hover:bg-white/10 text-white rounded-lg transition-all flex items-center justify-center gap-2"
-                    >
-                      <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
-                        <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M10 6H6a2 2 0 00-2 2v10a2 2 0 002 2h10a2 2 0 002-2v-4M14 4h6m0 0v6m0-6L10 14" />
-                      </svg>
-                      Open in New Tab
-                    </button>
-                  </div>
-                )}
-              </div>
-
-              {/* Info Panel */}
-              <div className="space-y-6">
-                <div className="bg-white/[0.02] border border-white/5 rounded-xl p-6">
-                  <h3 className="font-semibold mb-4 flex items-center gap-2">
-                    <span className="text-lg">📖</span> How it works
-                  </h3>
-                  <ol className="space-y-3 text-sm text-white/60">
-                    <li className="flex gap-3">
-                      <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">1</span>
-                      <span>Select a namespace to deploy your site into</span>
-                    </li>
-                    <li className="flex gap-3">
-                      <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">2</span>
-                      <span>Enter a unique name for your static site</span>
-                    </li>
-                    <li className="flex gap-3">
-                      <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">3</span>
-                      <span>Paste your complete HTML content</span>
-                    </li>
-                    <li className="flex gap-3">
-                      <span className="w-6 h-6 bg-white/10 rounded-full flex items-center justify-center text-xs font-medium shrink-0">4</span>
-                      <span>Click deploy and get your live URL instantly!</span>
-                    </li>
-                  </ol>
-                </div>
-
-                <div className="bg-white/[0.02] border border-white/5 rounded-xl p-6">
-                  <h3 className="font-semibold mb-4 flex items-center gap-2">
-                    <span className="text-lg">💡</span> Tips
-                  </h3>
-                  <ul className="space-y-2 text-sm text-white/60">
-                    <li className="flex gap-2">
-                      <span className="text-pink-400">•</span>
-                      Include all CSS/JS inline or via CDN links
-                    </li>
-                    <li className="flex gap-2">
-                      <span className="text-pink-400">•</span>
-                      Perfect for landing pages, dashboards, and demos
-                    </li>
-                    <li className="flex gap-2">
-                      <span className="text-pink-400">•</span>
-                      HTML is served with proper content-type headers
-                    </li>
-                    <li className="flex gap-2">
-                      <span className="text-pink-400">•</span>
-                      Redeploy anytime by using the same site name
-                    </li>
-                  </ul>
-                </div>
-
-                <div className="bg-gradient-to-br from-pink-500/10 to-rose-500/10 border border-pink-500/20 rounded-xl p-6">
-                  <h3 className="font-semibold mb-2 text-pink-400">🚀 RideShare Demo</h3>
-                  <p className="text-sm text-white/60 mb-4">
-                    Try deploying the ride-sharing UI! Copy the HTML from the rideshare-app/index.html file and paste it here.
-                  </p>
-                  <button
-                    onClick={() => {
-                      setStaticSiteName("rideshare-demo");
-                      setStaticSiteHtml(`<!DOCTYPE html>
-<html>
-<head>
-  <title>RideShare Demo</title>
-</head>
-<body style="font-family: system-ui; display: flex; align-items: center; justify-content: center; min-height: 100vh; margin: 0; background: #0a0a0a; color: white;">
-  <div style="text-align: center;">
-    <h1>🚗 RideShare Demo</h1>
-    <p>Paste the full rideshare-app/index.html content here!</p>
-  </div>
-</body>
-</html>`);
-                    }}
-                    className="text-sm text-pink-400 hover:text-pink-300 font-medium"
-                  >
-                    Load placeholder template →
-                  </button>
-                </div>
-              </div>
-            </div>
-          </>
+        {/* Static Sites View - mounted on first visit, then kept mounted to preserve state */}
+        {openedViews.has("static-sites") && (
+          <div className={view === "static-sites" && !loading ? "" : "hidden"}>
+            <StaticSites namespaces={namespaces} onError={setError} />
+          </div>
         )}
 
-        {/* AI Builder View - kept mounted to preserve state */}
-        <div className={view === "ai-builder" ? "" : "hidden"}>
-          {!loading && (
+        {/* AI Builder View - mounted on first visit, then kept mounted to preserve state */}
+        {openedViews.has("ai-builder") && (
+          <div className={view === "ai-builder" && !loading ? "" : "hidden"}>
             <AIBuilder 
               namespaces={namespaces}
               onDeployComplete={(result) => {
                 console.log("Deployed:", result);
               }}
             />
-          )}
-        </div>
+          </div>
+        )}
       </main>
 
       {/* Create Database Modal */}
@@ -2536,6 +2624,42 @@ export default {
               rows={12}
               className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white placeholder:text-white/30 focus:outline-none focus:ring-2 focus:ring-orange-500/50 font-mono text-sm resize-none"
             />
+            <div className="grid grid-cols-2 gap-4 mt-4">
+              <div>
+                <label className="block text-sm font-medium mb-2 text-white/70">Placement</label>
+                <select
+                  value={newScriptOptions.placementMode || ""}
+                  onChange={(e) => setNewScriptOptions({ ...newScriptOptions, placementMode: (e.target.value || undefined) as PlacementMode | undefined })}
+                  className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white focus:outline-none focus:ring-2 focus:ring-orange-500/50 text-sm"
+                >
+                  <option value="" className="bg-[#1a1a1a]">Default (off)</option>
+                  <option value="smart" className="bg-[#1a1a1a]">Smart: run near backends</option>
+                </select>
+              </div>
+              <div>
+                <label className="block text-sm font-medium mb-2 text-white/70">CPU Limit (ms)</label>
+                <input
+                  type="number"
+                  min={CPU_MS_MIN}
+                  max={CPU_MS_MAX}
+                  value={newScriptOptions.cpuMs ?? ""}
+                  onChange={(e) => setNewScriptOptions({ ...newScriptOptions, cpuMs: e.target.value ? Number(e.target.value) : undefined })}
+                  placeholder="Default"
+                  className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white placeholder:text-white/30 focus:outline-none focus:ring-2 focus:ring-orange-500/50 font-mono text-sm"
+                />
+              </div>
+              <div>
+                <label className="block text-sm font-medium mb-2 text-white/70">Compatibility Date</label>
+                <input
+                  type="date"
+                  max={latestCompatibilityDate()}
+                  value={newScriptOptions.compatibilityDate || ""}
+                  onChange={(e) => setNewScriptOptions({ ...newScriptOptions, compatibilityDate: e.target.value || undefined })}
+                  className="w-full px-4 py-3 bg-white/5 border border-white/10 rounded-xl text-white focus:outline-none focus:ring-2 focus:ring-orange-500/50 font-mono text-sm [color-scheme:dark]"
+                />
+                <p className="text-xs text-white/40 mt-1">Leave empty to use today</p>
+              </div>
+            </div>
             <div className="flex gap-3 mt-6">
               <button
                 type="button"
@@ -2860,26 +2984,54 @@ export default {
 
       {/* Bulk Delete Confirmation Modal */}
       {showBulkDeleteConfirm && (
-        <Modal onClose={() => !submitting && setShowBulkDeleteConfirm(false)}>
+        <Modal onClose={() => !submitting && closeBulkDelete()}>
           <div className="w-12 h-12 mx-auto mb-4 rounded-full bg-red-500/10 flex items-center justify-center">
             <svg className="w-6 h-6 text-red-400" fill="none" viewBox="0 0 24 24" stroke="currentColor">
               <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M12 9v2m0 4h.01m-6.938 4h13.856c1.54 0 2.502-1.667 1.732-3L13.732 4c-.77-1.333-2.694-1.333-3.464 0L3.34 16c-.77 1.333.192 3 1.732 3z" />
             </svg>
           </div>
           <h3 className="text-lg font-semibold text-center mb-2">
-            Delete {view === "namespaces" ? selectedNamespaces.size : selectedScripts.size} {view === "namespaces" ? "namespace" : "script"}{(view === "namespaces" ? selectedNamespaces.size : selectedScripts.size) !== 1 ? "s" : ""}
+            {bulkDeleteIds === null
+              ? `Delete ${view === "namespaces" ? "namespaces" : "scripts"}`
+              : `Delete ${bulkDeleteIds.length} ${view === "namespaces" ? "namespace" : "script"}${bulkDeleteIds.length !== 1 ? "s" : ""}`}
           </h3>
           <p className="text-sm text-white/50 text-center mb-4">
             Are you sure you want to delete the following {view === "namespaces" ? "namespaces" : "scripts"}?
           </p>
           <div className="mb-6 max-h-40 overflow-y-auto p-3 bg-black/30 rounded-lg">
-            <div className="flex flex-wrap gap-2">
-              {(view === "namespaces" ? Array.from(selectedNamespaces) : Array.from(selectedScripts)).map(item => (
-                <span key={item} className="px-2 py-1 text-xs font-mono bg-white/5 rounded-md text-white/70">
-                  {item}
-                </span>
-              ))}
-            </div>
+            {bulkDeleteIds === null ? (
+              <div className="flex items-center gap-2 text-sm text-white/50">
+                <div className="w-4 h-4 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+                Resolving selection...
+              </div>
+            ) : (
+              <>
+                {bulkSelection.all && (
+                  <p className="text-sm text-white/70 mb-2">
+                    All {bulkDeleteIds.length} {view === "namespaces" ? "namespaces" : "scripts"}
+                    {bulkQuery.q ? ` matching "${bulkQuery.q}"` : ""}
+                    {bulkSelection.excluded.size > 0 ? ` (${bulkSelection.excluded.size} excluded)` : ""}
+                    {bulkDeleteIds.length !== bulkSelectionCount && (
+                      <span className="block text-amber-400 mt-1">
+                        The list showed {bulkSelectionCount}; it has changed since. Only the {bulkDeleteIds.length} below will be deleted.
+                      </span>
+                    )}
+                  </p>
+                )}
+                <div className="flex flex-wrap gap-2">
+                  {bulkDeleteIds.slice(0, BULK_PREVIEW_LIMIT).map(item => (
+                    <span key={item} className="px-2 py-1 text-xs font-mono bg-white/5 rounded-md text-white/70">
+                      {item}
+                    </span>
+                  ))}
+                  {bulkDeleteIds.length > BULK_PREVIEW_LIMIT && (
+                    <span className="px-2 py-1 text-xs text-white/40">
+                      +{bulkDeleteIds.length - BULK_PREVIEW_LIMIT} more
+                    </span>
+                  )}
+                </div>
+              </>
+            )}
           </div>
           
           {bulkDeleteProgress && (
@@ -2899,7 +3051,7 @@ export default {
           
           <div className="flex gap-3">
             <button
-              onClick={() => setShowBulkDeleteConfirm(false)}
+              onClick={closeBulkDelete}
               disabled={submitting}
               className="flex-1 px-4 py-2.5 text-sm font-medium text-white/70 hover:text-white bg-white/5 hover:bg-white/10 rounded-xl transition-all disabled:opacity-50"
             >
@@ -2907,7 +3059,7 @@ export default {
             </button>
             <button
               onClick={handleBulkDelete}
-              disabled={submitting}
+              disabled={submitting || !bulkDeleteIds || bulkDeleteIds.length === 0}
               className="flex-1 px-4 py-2.5 text-sm font-medium bg-red-500 text-white rounded-xl hover:bg-red-600 disabled:opacity-50 transition-all"
             >
               {submitting ? "Deleting..." : "Delete All"}
@@ -2919,6 +3071,240 @@ export default {
   );
 }
 
+// Debounced search box + sort controls for the server-side lists
+function ListToolbar({
+  query,
+  onChange,
+  placeholder,
+  sortOptions,
+  loading,
+}: {
+  query: ListQuery;
+  onChange: (query: ListQuery) => void;
+  placeholder: string;
+  sortOptions: { value: string; label: string }[];
+  loading: boolean;
+}) {
+  const [search, setSearch] = useState(query.q);
+
+  useEffect(() => {
+    const timer = setTimeout(() => {
+      if (search.trim() !== query.q) onChange({ ...query, q: search.trim() });
+    }, 250);
+    return () => clearTimeout(timer);
+  }, [search, query, onChange]);
+
+  return (
+    <div className="flex items-center gap-3 mb-4">
+      <div className="relative flex-1">
+        <svg className="absolute left-3 top-1/2 -translate-y-1/2 w-4 h-4 text-white/30" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+          <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M21 21l-4.35-4.35M17 11a6 6 0 11-12 0 6 6 0 0112 0z" />
+        </svg>
+        <input
+          type="text"
+          value={search}
+          onChange={(e) => setSearch(e.target.value)}
+          placeholder={placeholder}
+          className="w-full pl-9 pr-9 py-2.5 bg-white/5 border border-white/10 rounded-xl text-sm text-white placeholder:text-white/30 focus:outline-none focus:ring-2 focus:ring-orange-500/50"
+        />
+        {loading && (
+          <div className="absolute right-3 top-1/2 -translate-y-1/2 w-4 h-4 border-2 border-white/20 border-t-orange-500 rounded-full animate-spin" />
+        )}
+      </div>
+      <select
+        value={query.sort}
+        onChange={(e) => onChange({ ...query, sort: e.target.value })}
+        className="px-3 py-2.5 bg-white/5 border border-white/10 rounded-xl text-sm text-white focus:outline-none"
+      >
+        {sortOptions.map((option) => (
+          <option key={option.value} value={option.value} className="bg-[#1a1a1a]">
+            {option.label}
+          </option>
+        ))}
+      </select>
+      <button
+        onClick={() => onChange({ ...query, order: query.order === "asc" ? "desc" : "asc" })}
+        title={query.order === "asc" ? "Ascending" : "Descending"}
+        className="p-2.5 bg-white/5 border border-white/10 rounded-xl text-white/60 hover:text-white transition-all"
+      >
+        <svg className={`w-4 h-4 transition-transform ${query.order === "desc" ? "rotate-180" : ""}`} fill="none" viewBox="0 0 24 24" stroke="currentColor">
+          <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M5 15l7-7 7 7" />
+        </svg>
+      </button>
+    </div>
+  );
+}
+
+// "Select all matching" bar above a selectable list
+function SelectionBar({
+  selection,
+  total,
+  onToggleAll,
+  onDelete,
+}: {
+  selection: Selection;
+  total: number;
+  onToggleAll: () => void;
+  onDelete: () => void;
+}) {
+  const count = selectionCount(selection, total);
+  const allSelected = count === total && total > 0;
+
+  return (
+    <div className="flex items-center gap-4 mb-4 p-3 bg-white/[0.02] border border-white/5 rounded-xl">
+      <label className="flex items-center gap-3 cursor-pointer select-none">
+        <div className="relative">
+          <input
+            type="checkbox"
+            checked={allSelected}
+            onChange={onToggleAll}
+            className="peer sr-only"
+          />
+          <div className="w-5 h-5 border-2 border-white/20 rounded-md peer-checked:border-orange-500 peer-checked:bg-orange-500 transition-all flex items-center justify-center">
+            {allSelected && (
+              <svg className="w-3 h-3 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor" strokeWidth={3}>
+                <path strokeLinecap="round" strokeLinejoin="round" d="M5 13l4 4L19 7" />
+              </svg>
+            )}
+            {count > 0 && count < total && (
+              <div className="w-2.5 h-0.5 bg-orange-500 rounded" />
+            )}
+          </div>
+        </div>
+        <span className="text-sm text-white/60">
+          {count === 0
+            ? `Select all ${total} matching`
+            : `${count} of ${total} selected`}
+        </span>
+      </label>
+      {count > 0 && (
+        <button
+          onClick={onDelete}
+          className="ml-auto px-4 py-2 text-sm font-medium bg-red-500/10 text-red-400 hover:bg-red-500/20 rounded-lg transition-all flex items-center gap-2"
+        >
+          <svg className="w-4 h-4" fill="none" viewBox="0 0 24 24" stroke="currentColor">
+            <path strokeLinecap="round" strokeLinejoin="round" strokeWidth={2} d="M19 7l-.867 12.142A2 2 0 0116.138 21H7.862a2 2 0 01-1.995-1.858L5 7m5 4v6m4-6v6m1-10V4a1 1 0 00-1-1h-4a1 1 0 00-1 1v3M4 7h16" />
+          </svg>
+          Delete Selected
+        </button>
+      )}
+    </div>
+  );
+}
+
+function RowCheckbox({ checked, onToggle }: { checked: boolean; onToggle: () => void }) {
+  return (
+    <div
+      className="pt-0.5"
+      onClick={(e) => {
+        e.stopPropagation();
+        onToggle();
+      }}
+    >
+      <div className="relative">
+        <input
+          type="checkbox"
+          checked={checked}
+          onChange={onToggle}
+          className="peer sr-only"
+        />
+        <div className="w-5 h-5 border-2 border-white/20 rounded-md peer-checked:border-orange-500 peer-checked:bg-orange-500 transition-all flex items-center justify-center hover:border-white/40">
+          {checked && (
+            <svg className="w-3 h-3 text-white" fill="none" viewBox="0 0 24 24" stroke="currentColor" strokeWidth={3}>
+              <path strokeLinecap="round" strokeLinejoin="round" d="M5 13l4 4L19 7" />
+            </svg>
+          )}
+        </div>
+      </div>
+    </div>
+  );
+}
+
+// Numeric fields of a time series bucket, other than its timestamp
+type SeriesKey<B> = Exclude<{ [K in keyof B]: B[K] extends number ? K : never }[keyof B], "t"> & string;
+
+// Line chart for metrics time series
+function MetricsChart<B extends { t: number }>({
+  title,
+  series,
+  lines,
+  unit = "",
+}: {
+  title: string;
+  series: B[];
+  lines: { key: SeriesKey<B>; label: string; color: string }[];
+  unit?: string;
+}) {
+  const width = 600;
+  const height = 120;
+  const value = (b: B, key: SeriesKey<B>) => Number(b[key]);
+  const max = Math.max(1, ...series.flatMap((b) => lines.map((l) => value(b, l.key))));
+  const first = series[0]?.t ?? 0;
+  const span = Math.max(1, (series[series.length - 1]?.t ?? 0) - first);
+  const x = (t: number) => (series.length === 1 ? width / 2 : ((t - first) / span) * width);
+  const y = (v: number) => height - (v / max) * height;
+
+  return (
+    <div className="p-4 bg-white/[0.02] border border-white/5 rounded-lg">
+      <div className="flex items-center justify-between mb-3">
+        <h4 className="text-sm font-medium text-white/70">{title}</h4>
+        <div className="flex gap-3 text-xs text-white/40">
+          {lines.map((l) => (
+            <span key={l.key} className="flex items-center gap-1">
+              <span className="w-2 h-2 rounded-full" style={{ backgroundColor: l.color }} />
+              {l.label}
+            </span>
+          ))}
+          <span className="font-mono">max {max.toFixed(0)}{unit && ` ${unit}`}</span>
+        </div>
+      </div>
+      <svg viewBox={`0 0 ${width} ${height}`} preserveAspectRatio="none" className="w-full h-32">
+        {lines.map((l) => (
+          <polyline
+            key={l.key}
+            fill="none"
+            stroke={l.color}
+            strokeWidth={1.5}
+            vectorEffect="non-scaling-stroke"
+            points={series.map((b) => `${x(b.t)},${y(value(b, l.key))}`).join(" ")}
+          />
+        ))}
+      </svg>
+      <div className="flex justify-between mt-1 text-[10px] text-white/30 font-mono">
+        <span>{series.length > 0 ? new Date(first * 1000).toLocaleString() : ""}</span>
+        <span>{series.length > 0 ? new Date((first + span) * 1000).toLocaleString() : ""}</span>
+      </div>
+    </div>
+  );
+}
+
+// Bar chart of call counts per duration range
+function DurationHistogram({ counts, bucketsMs }: { counts: number[]; bucketsMs: number[] }) {
+  const max = Math.max(1, ...counts);
+  const label = (i: number) => (i < bucketsMs.length ? `<${bucketsMs[i]}` : `≥${bucketsMs[bucketsMs.length - 1]}`);
+
+  return (
+    <div className="p-4 bg-white/[0.02] border border-white/5 rounded-lg">
+      <h4 className="text-sm font-medium text-white/70 mb-3">Duration distribution (ms)</h4>
+      <div className="flex items-end gap-1 h-24">
+        {counts.map((count, i) => (
+          <div key={i} className="flex-1 h-full flex flex-col justify-end" title={`${label(i)} ms: ${count} calls`}>
+            <div
+              className={`rounded-t ${count > 0 ? "bg-cyan-500/60" : "bg-white/5"}`}
+              style={{ height: `${Math.max(2, (count / max) * 100)}%` }}
+            />
+          </div>
+        ))}
+      </div>
+      <div className="flex gap-1 mt-1 text-[10px] text-white/30 font-mono">
+        {counts.map((_, i) => (
+          <span key={i} className="flex-1 text-center">{label(i)}</span>
+        ))}
+      </div>
+    </div>
+  );
+}
+
 // Modal Component
 function Modal({ children, onClose, wide = false }: { children: React.ReactNode; onClose: () => void; wide?: boolean }) {
   return (
@@ -0,0 +1,220 @@
+#!/usr/bin/env node
+// Local build benchmark: builds the app, reports the JS each route loads up
+// front versus on demand, and fails when a route exceeds bundle-budget.json.
+//
+//   npm run bench:bundle               # next build + report + budget check
+//   npm run bench:bundle -- --no-build # reuse the existing .next output
+//   npm run bench:bundle -- --record   # store the measurement as each route's
+//                                      # baseline and reset its limits to the
+//                                      # baseline plus `headroom`
+//   npm run bench:bundle -- --compare=<git ref>
+//                                      # also build <ref> in a temporary git
+//                                      # worktree and report before/after;
+//                                      # with --record the "before" numbers
+//                                      # are stored next to the baseline
+//
+// A route without a recorded baseline fails the check: its limits were never
+// measured, so passing them says nothing.
+//
+// First-load JS is read from the prerendered HTML (every <script src> the
+// browser fetches before hydrating), so it does not depend on bundler-specific
+// manifests. Time-to-interactive is estimated from that JS with the network
+// and CPU profile in bundle-budget.json:
+//   TTI ~= 2 RTT (connect + HTML) + HTML transfer
+//        + 1 RTT + JS transfer (gzip) + JS parse/execute (raw KB * jsMsPerKb)
+
+import { execSync } from "node:child_process";
+import { existsSync, mkdtempSync, readFileSync, readdirSync, rmSync, statSync, symlinkSync, writeFileSync } from "node:fs";
+import { tmpdir } from "node:os";
+import path from "node:path";
+import { gzipSync } from "node:zlib";
+
+const root = path.resolve(path.dirname(new URL(import.meta.url).pathname), "..");
+const budgetFile = path.join(root, "bundle-budget.json");
+const budget = JSON.parse(readFileSync(budgetFile, "utf8"));
+const skipBuild = process.argv.includes("--no-build");
+const record = process.argv.includes("--record");
+const compareRef = process.argv.find((a) => a.startsWith("--compare="))?.slice("--compare=".length);
+
+const kb = (bytes) => bytes / 1024;
+const fmtKb = (bytes) => `${kb(bytes).toFixed(1)} KB`;
+
+function sizes(file) {
+  const raw = readFileSync(file);
+  return { raw: raw.length, gzip: gzipSync(raw, { level: 9 }).length };
+}
+
+function listChunks(dir) {
+  if (!existsSync(dir)) return [];
+  return readdirSync(dir).flatMap((entry) => {
+    const full = path.join(dir, entry);
+    if (statSync(full).isDirectory()) return listChunks(full);
+    return entry.endsWith(".js") ? [full] : [];
+  });
+}
+
+function estimateTti(htmlGzip, jsGzip, jsRaw) {
+  const { rttMs, downloadKbps, jsMsPerKb } = budget.profile;
+  const bytesPerMs = (downloadKbps * 1000) / 8 / 1000;
+  return 3 * rttMs + htmlGzip / bytesPerMs + jsGzip / bytesPerMs + kb(jsRaw) * jsMsPerKb;
+}
+
+function build(appDir) {
+  const started = Date.now();
+  execSync("npx next build", { cwd: appDir, stdio: "inherit" });
+  console.log(`\nBuild finished in ${((Date.now() - started) / 1000).toFixed(1)}s`);
+}
+
+// First-load scripts per budgeted route, plus the chunks nothing loads up front
+function measure(appDir) {
+  const nextDir = path.join(appDir, ".next");
+  const firstLoadFiles = new Set();
+  const routes = {};
+
+  for (const route of Object.keys(budget.routes)) {
+    const name = route === "/" ? "index" : route.replace(/^\//, "");
+    const htmlFile = path.join(nextDir, "server", "app", `${name}.html`);
+    if (!existsSync(htmlFile)) {
+      routes[route] = { missing: path.relative(appDir, htmlFile) };
+      continue;
+    }
+
+    const html = readFileSync(htmlFile, "utf8");
+    const srcs = [...new Set([...html.matchAll(/<script[^>]+src="([^"]+\.js)"/g)].map((m) => m[1]))];
+    const scripts = srcs
+      .filter((src) => src.startsWith("/_next/"))
+      .map((src) => {
+        const file = path.join(nextDir, decodeURIComponent(src.replace(/^\/_next\//, "")));
+        firstLoadFiles.add(file);
+        return { src, ...sizes(file) };
+      })
+      .sort((a, b) => b.gzip - a.gzip);
+
+    const jsRaw = scripts.reduce((sum, s) => sum + s.raw, 0);
+    const jsGzip = scripts.reduce((sum, s) => sum + s.gzip, 0);
+    routes[route] = { scripts, jsRaw, jsGzip, tti: estimateTti(gzipSync(html).length, jsGzip, jsRaw) };
+  }
+
+  // Everything else in static/chunks is fetched on demand (dynamic imports)
+  const lazy = listChunks(path.join(nextDir, "static", "chunks"))
+    .filter((file) => !firstLoadFiles.has(file))
+    .map((file) => ({ file: path.relative(nextDir, file), ...sizes(file) }))
+    .sort((a, b) => b.gzip - a.gzip);
+
+  return { routes, lazy };
+}
+
+// Build another revision of the app in a throwaway worktree, reusing this
+// checkout's node_modules
+function measureRef(ref) {
+  const repoRoot = execSync("git rev-parse --show-toplevel", { cwd: root, encoding: "utf8" }).trim();
+  const worktree = mkdtempSync(path.join(tmpdir(), "bundle-budget-"));
+  execSync(`git worktree add --detach "${worktree}" "${ref}"`, { cwd: root, stdio: "inherit" });
+  try {
+    const appDir = path.join(worktree, path.relative(repoRoot, root));
+    symlinkSync(path.join(root, "node_modules"), path.join(appDir, "node_modules"), "dir");
+    console.log(`\nBuilding ${ref} for comparison...`);
+    build(appDir);
+    return measure(appDir);
+  } finally {
+    execSync(`git worktree remove --force "${worktree}"`, { cwd: root });
+    rmSync(worktree, { recursive: true, force: true });
+  }
+}
+
+// Fail on a bad ref before spending a build on the current tree
+if (compareRef) {
+  try {
+    execSync(`git rev-parse --verify --quiet "${compareRef}^{commit}"`, { cwd: root, stdio: "ignore" });
+  } catch {
+    console.error(`--compare: unknown git ref "${compareRef}"`);
+    process.exit(1);
+  }
+}
+
+if (!skipBuild) build(root);
+
+if (!existsSync(path.join(root, ".next"))) {
+  console.error("No .next output found; run without --no-build first.");
+  process.exit(1);
+}
+
+const current = measure(root);
+const before = compareRef ? measureRef(compareRef) : null;
+const commit = execSync("git rev-parse --short HEAD", { cwd: root, encoding: "utf8" }).trim();
+let failed = false;
+
+for (const [route, limits] of Object.entries(budget.routes)) {
+  const m = current.routes[route];
+  if (m.missing) {
+    console.error(`\n${route}: no prerendered HTML at ${m.missing}`);
+    failed = true;
+    continue;
+  }
+
+  console.log(`\nRoute ${route}: ${m.scripts.length} first-load scripts`);
+  for (const s of m.scripts) {
+    console.log(`  ${fmtKb(s.gzip).padStart(10)} gz ${fmtKb(s.raw).padStart(10)}  ${s.src}`);
+  }
+
+  const b = before?.routes[route];
+  if (b && !b.missing) {
+    const pct = (now, then) => `${now >= then ? "+" : ""}${(((now - then) / then) * 100).toFixed(1)}%`;
+    console.log(
+      `  vs ${compareRef}: first-load ${fmtKb(b.jsGzip)} -> ${fmtKb(m.jsGzip)} gzip (${pct(m.jsGzip, b.jsGzip)}), ` +
+        `TTI ${Math.round(b.tti)} -> ${Math.round(m.tti)} ms (${pct(m.tti, b.tti)})`
+    );
+  }
+
+  if (record) {
+    limits.baseline = {
+      firstLoadJsGzipKb: Number(kb(m.jsGzip).toFixed(1)),
+      estimatedTtiMs: Math.round(m.tti),
+      commit,
+      measuredAt: new Date().toISOString().split("T")[0],
+      ...(b && !b.missing
+        ? {
+            before: {
+              commit: execSync(`git rev-parse --short "${compareRef}^{commit}"`, { cwd: root, encoding: "utf8" }).trim(),
+              firstLoadJsGzipKb: Number(kb(b.jsGzip).toFixed(1)),
+              estimatedTtiMs: Math.round(b.tti),
+            },
+          }
+        : {}),
+    };
+    limits.firstLoadJsGzipKb = Math.ceil(kb(m.jsGzip) * (1 + budget.headroom));
+    limits.estimatedTtiMs = Math.ceil((m.tti * (1 + budget.headroom)) / 100) * 100;
+  }
+
+  const jsOk = kb(m.jsGzip) <= limits.firstLoadJsGzipKb;
+  const ttiOk = m.tti <= limits.estimatedTtiMs;
+  failed ||= !jsOk || !ttiOk || !limits.baseline;
+  console.log(
+    `  First-load JS: ${fmtKb(m.jsGzip)} gzip (${fmtKb(m.jsRaw)} raw), budget ${limits.firstLoadJsGzipKb} KB ${jsOk ? "ok" : "EXCEEDED"}`
+  );
+  console.log(
+    `  Estimated TTI (${budget.profile.name}): ${Math.round(m.tti)} ms, budget ${limits.estimatedTtiMs} ms ${ttiOk ? "ok" : "EXCEEDED"}`
+  );
+  if (limits.baseline) {
+    const { firstLoadJsGzipKb, estimatedTtiMs, measuredAt } = limits.baseline;
+    console.log(`  Baseline: ${firstLoadJsGzipKb} KB gzip, ${estimatedTtiMs} ms (${limits.baseline.commit}, ${measuredAt})`);
+  } else {
+    console.log("  Baseline: MISSING; these limits were never measured (run with --record)");
+  }
+}
+
+if (record) {
+  writeFileSync(budgetFile, JSON.stringify(budget, null, 2) + "\n");
+  console.log(`\nRecorded baselines in ${path.relative(root, budgetFile)}`);
+}
+
+console.log(`\nOn-demand chunks: ${current.lazy.length}, ${fmtKb(current.lazy.reduce((sum, c) => sum + c.gzip, 0))} gzip total`);
+for (const c of current.lazy.slice(0, 10)) {
+  console.log(`  ${fmtKb(c.gzip).padStart(10)} gz ${fmtKb(c.raw).padStart(10)}  ${c.file}`);
+}
+
+if (failed) {
+  console.error("\nBundle budget exceeded or not measured.");
+  process.exit(1);
+}
+console.log("\nBundle budget ok.");
@@ -0,0 +1,259 @@
+#!/usr/bin/env node
+// Round-trip benchmark for script upload settings (placement, CPU limit,
+// compatibility date).
+//
+// Starts a local stand-in for the Cloudflare Workers for Platforms API and
+// points the platform UI at it through CLOUDFLARE_API_BASE_URL. Each case then
+// uploads a script through PUT /api/namespaces/[name]/scripts, reads it back
+// through GET .../settings, and checks both the metadata the stand-in received
+// and the settings the UI reports. Upload + readback latency is timed per case.
+//
+//   npm run bench:upload                                   # spawns `next dev`
+//   npm run bench:upload -- --platform-url=http://localhost:3000
+//       (the server must run with CLOUDFLARE_API_BASE_URL=http://127.0.0.1:8788)
+//   npm run bench:upload -- --iterations=50 --latency-ms=40
+
+import { spawn } from "node:child_process";
+import { createServer } from "node:http";
+import path from "node:path";
+
+const arg = (name, fallback) => {
+  const match = process.argv.find((a) => a.startsWith(`--${name}=`));
+  return match ? match.slice(name.length + 3) : fallback;
+};
+
+const root = path.resolve(path.dirname(new URL(import.meta.url).pathname), "..");
+const iterations = Number(arg("iterations", "10"));
+const latencyMs = Number(arg("latency-ms", "0"));
+const standInPort = Number(arg("stand-in-port", "8788"));
+const NAMESPACE = "bench-ns";
+const utcDate = (offsetDays) => new Date(Date.now() + offsetDays * 86_400_000).toISOString().split("T")[0];
+const today = utcDate(0);
+
+// ---------------------------------------------------------------------------
+// Stand-in Cloudflare API: stores upload metadata, serves it back as settings
+// ---------------------------------------------------------------------------
+
+const scripts = new Map(); // "ns/script" -> metadata
+const json = (res, status, body) => {
+  res.writeHead(status, { "Content-Type": "application/json" });
+  res.end(JSON.stringify(body));
+};
+
+const standIn = createServer(async (req, res) => {
+  const chunks = [];
+  for await (const chunk of req) chunks.push(chunk);
+  if (latencyMs > 0) await new Promise((r) => setTimeout(r, latencyMs));
+
+  const url = new URL(req.url, `http://127.0.0.1:${standInPort}`);
+  const match = url.pathname.match(
+    /^\/accounts\/[^/]+\/workers\/dispatch\/namespaces\/([^/]+)\/scripts(?:\/([^/]+))?(\/settings)?$/
+  );
+  if (!match) return json(res, 404, { success: false, errors: [{ message: "Not found" }] });
+  const [, ns, script, settings] = match;
+  const key = `${ns}/${script}`;
+
+  if (req.method === "GET" && !script) {
+    return json(res, 200, { success: true, result: [] });
+  }
+
+  if (req.method === "PUT" && script && !settings) {
+    const form = await new Request(url, {
+      method: "PUT",
+      headers: { "content-type": req.headers["content-type"] },
+      body: Buffer.concat(chunks),
+    }).formData();
+    const metadata = JSON.parse(form.get("metadata"));
+    if (!form.get(metadata.main_module)) {
+      return json(res, 400, { success: false, errors: [{ message: "main_module part missing" }] });
+    }
+    scripts.set(key, metadata);
+    return json(res, 200, { success: true, result: { id: script } });
+  }
+
+  if (req.method === "GET" && settings) {
+    const metadata = scripts.get(key);
+    if (!metadata) return json(res, 404, { success: false, errors: [{ message: "Script not found" }] });
+    return json(res, 200, {
+      success: true,
+      result: {
+        compatibility_date: metadata.compatibility_date,
+        compatibility_flags: metadata.compatibility_flags || [],
+        placement: metadata.placement || {},
+        limits: metadata.limits || {},
+        bindings: [],
+        tags: [],
+        logpush: false,
+      },
+    });
+  }
+
+  json(res, 405, { success: false, errors: [{ message: "Method not allowed" }] });
+});
+
+// ---------------------------------------------------------------------------
+// Cases
+// ---------------------------------------------------------------------------
+
+const cases = [
+  {
+    name: "defaults",
+    fields: {},
+    expect: { placement: undefined, cpu_ms: undefined, compatibility_date: today },
+  },
+  {
+    name: "smart + cpu 50ms + pinned date",
+    fields: { placementMode: "smart", cpuMs: "50", compatibilityDate: "2024-09-23" },
+    expect: { placement: "smart", cpu_ms: 50, compatibility_date: "2024-09-23" },
+  },
+  {
+    name: "off + cpu 30s",
+    fields: { placementMode: "off", cpuMs: "30000", compatibilityDate: "2025-01-01" },
+    expect: { placement: undefined, cpu_ms: 30000, compatibility_date: "2025-01-01" },
+  },
+  { name: "rejects cpu below minimum", fields: { cpuMs: "5" }, expectStatus: 400 },
+  {
+    // "today" for a user east of UTC
+    name: "accepts UTC tomorrow",
+    fields: { compatibilityDate: utcDate(1) },
+    expect: { placement: undefined, cpu_ms: undefined, compatibility_date: utcDate(1) },
+  },
+  { name: "rejects date after UTC tomorrow", fields: { compatibilityDate: utcDate(2) }, expectStatus: 400 },
+  { name: "rejects unknown placement", fields: { placementMode: "nearest" }, expectStatus: 400 },
+];
+
+async function upload(platformUrl, scriptName, fields) {
+  const form = new FormData();
+  form.append("scriptName", scriptName);
+  form.append("script", 'export default { fetch() { return new Response("ok"); } };');
+  form.append("mainModule", "index.js");
+  for (const [k, v] of Object.entries(fields)) form.append(k, v);
+  return fetch(`${platformUrl}/api/namespaces/${NAMESPACE}/scripts`, { method: "PUT", body: form });
+}
+
+function compare(label, actual, expected) {
+  const diffs = [];
+  for (const [field, value] of Object.entries(expected)) {
+    if (actual[field] !== value) diffs.push(`${label}.${field}: expected ${value}, got ${actual[field]}`);
+  }
+  return diffs;
+}
+
+const percentile = (sorted, q) => sorted[Math.min(sorted.length - 1, Math.ceil(q * sorted.length) - 1)];
+
+async function runCases(platformUrl) {
+  let failures = 0;
+  for (const [index, c] of cases.entries()) {
+    const durations = [];
+    const problems = [];
+    for (let i = 0; i < iterations && problems.length === 0; i++) {
+      const scriptName = `bench-${index}-${i}`;
+      const started = performance.now();
+      const response = await upload(platformUrl, scriptName, c.fields);
+
+      if (c.expectStatus) {
+        await response.text();
+        durations.push(performance.now() - started);
+        if (response.status !== c.expectStatus) problems.push(`expected HTTP ${c.expectStatus}, got ${response.status}`);
+        continue;
+      }
+      if (!response.ok) {
+        problems.push(`upload failed: HTTP ${response.status} ${await response.text()}`);
+        break;
+      }
+      await response.json();
+
+      const settingsResponse = await fetch(
+        `${platformUrl}/api/namespaces/${NAMESPACE}/scripts/${scriptName}/settings`
+      );
+      const settings = await settingsResponse.json();
+      durations.push(performance.now() - started);
+
+      const sent = scripts.get(`${NAMESPACE}/${scriptName}`) || {};
+      problems.push(
+        ...compare(
+          "metadata",
+          {
+            placement: sent.placement?.mode,
+            cpu_ms: sent.limits?.cpu_ms,
+            compatibility_date: sent.compatibility_date,
+          },
+          c.expect
+        ),
+        ...compare(
+          "settings",
+          {
+            placement: settings.placement?.mode,
+            cpu_ms: settings.limits?.cpu_ms,
+            compatibility_date: settings.compatibility_date,
+          },
+          c.expect
+        )
+      );
+    }
+
+    const sorted = durations.sort((a, b) => a - b);
+    const timing = sorted.length
+      ? `p50 ${percentile(sorted, 0.5).toFixed(1)} ms, p95 ${percentile(sorted, 0.95).toFixed(1)} ms (n=${sorted.length})`
+      : "no samples";
+    console.log(`${problems.length ? "FAIL" : "ok  "}  ${c.name.padEnd(34)} ${timing}`);
+    for (const p of problems) console.log(`        ${p}`);
+    if (problems.length) failures++;
+  }
+  return failures;
+}
+
+// ---------------------------------------------------------------------------
+// Main
+// ---------------------------------------------------------------------------
+
+async function waitFor(url, timeoutMs) {
+  const deadline = Date.now() + timeoutMs;
+  while (Date.now() < deadline) {
+    try {
+      const response = await fetch(url);
+      if (response.ok) return;
+    } catch {
+      // not up yet
+    }
+    await new Promise((r) => setTimeout(r, 500));
+  }
+  throw new Error(`Timed out waiting for ${url}`);
+}
+
+await new Promise((resolve) => standIn.listen(standInPort, "127.0.0.1", resolve));
+console.log(`Stand-in Cloudflare API on http://127.0.0.1:${standInPort} (latency ${latencyMs} ms)`);
+
+let platformUrl = arg("platform-url", "");
+let server;
+if (!platformUrl) {
+  const port = arg("port", "3100");
+  platformUrl = `http://127.0.0.1:${port}`;
+  server = spawn("npx", ["next", "dev", "-p", port], {
+    cwd: root,
+    stdio: ["ignore", "ignore", "inherit"],
+    env: {
+      ...process.env,
+      CLOUDFLARE_API_BASE_URL: `http://127.0.0.1:${standInPort}`,
+      CLOUDFLARE_ACCOUNT_ID: "bench",
+      CLOUDFLARE_API_TOKEN_READ: "bench",
+      CLOUDFLARE_API_TOKEN_EDIT: "bench",
+    },
+  });
+  console.log(`Starting next dev on ${platformUrl} ...`);
+}
+
+let failures = 1;
+try {
+  await waitFor(`${platformUrl}/api/namespaces/${NAMESPACE}/scripts`, 120_000);
+  console.log(`Running ${cases.length} cases x ${iterations} iterations\n`);
+  failures = await runCases(platformUrl);
+} catch (error) {
+  console.error(error);
+} finally {
+  server?.kill();
+  standIn.close();
+}
+
+console.log(failures ? `\n${failures} case(s) failed.` : "\nAll upload settings round-tripped.");
+process.exit(failures ? 1 : 0);